@@ -0,0 +1,227 @@
+/*!
+    \file "benchmark.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Scaling benchmarks for the course schedule engines.
+
+    Each benchmark times a complete canFinish() call (graph construction
+    included) on a generated workload and reports:
+      * time/edge:   wall time per prerequisite.
+      * allocs:      heap allocations per canFinish() call.
+      * peak_rss_MB: process peak resident set size so far.  It only grows,
+                     so read it in benchmark order (small to large).
+
+    Run a subset with e.g. --benchmark_filter='Chain'.
+*/
+
+#include <benchmark/benchmark.h> //!\sa https://github.com/google/benchmark/blob/main/docs/user_guide.md
+
+#include "course_schedule.hpp"
+#include "workloads.hpp"
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+namespace {
+
+std::atomic<std::size_t> allocationCount{0};
+
+} // namespace {
+
+// Count every heap allocation made by the process.
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (auto const memory = std::malloc(0 == size ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+// std::pmr::new_delete_resource() allocates through the aligned form.
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    auto const align = static_cast<std::size_t>(alignment);
+    auto const roundedSize = (0 == size ? align : (size + align - 1) / align * align);
+    if (auto const memory = std::aligned_alloc(align, roundedSize)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+// GCC cannot tell that these replace the operator new above.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+enum class workload_kind_t { chain, wideDag, sparseDag, denseDag, lateCycle };
+
+/*!
+    \brief Generate (or reuse) the workload with roughly 'edgeCount' prerequisites.
+
+    Only the most recent workload is cached: benchmarks of the same size run
+    back to back, and keeping every size alive would dominate peak RSS.
+*/
+workload_t const&
+workload(workload_kind_t kind, int edgeCount) {
+    static workload_kind_t cachedKind{};
+    static int cachedEdgeCount = -1;
+    static workload_t cached{};
+    if (cachedKind != kind || cachedEdgeCount != edgeCount) {
+        cached = {};
+        switch (kind) {
+        case workload_kind_t::chain:
+            cached = makeChainWorkload(edgeCount);
+            break;
+        case workload_kind_t::wideDag:
+            cached = makeWideDagWorkload(edgeCount, 8);
+            break;
+        case workload_kind_t::sparseDag:
+            cached = makeRandomDagWorkload((std::max)(2, edgeCount / 2), edgeCount, 8);
+            break;
+        case workload_kind_t::denseDag: {
+            // Half of all possible prerequisites are present: E ~= V * V / 4.
+            auto const numCourses = (std::max)(2, static_cast<int>(2.0 * std::sqrt(static_cast<double>(edgeCount))));
+            cached = makeRandomDagWorkload(numCourses, edgeCount, 8);
+            break;
+        }
+        case workload_kind_t::lateCycle:
+            cached = makeLateCycleWorkload(edgeCount, 8);
+            break;
+        }
+        cachedKind = kind;
+        cachedEdgeCount = edgeCount;
+    }
+    return cached;
+}
+
+template <typename Engine, workload_kind_t Kind>
+void
+BM_CanFinish(benchmark::State& state) {
+    auto const& catalog = workload(Kind, static_cast<int>(state.range(0)));
+    auto const prerequisites = std::span<std::pair<int, int> const>{catalog.prerequisites};
+    auto const expected = workload_kind_t::lateCycle != Kind;
+
+    auto const allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        Engine engine{};
+        auto const result = engine.canFinish(catalog.numCourses, prerequisites);
+        benchmark::DoNotOptimize(result);
+        if (expected != result) {
+            state.SkipWithError("unexpected canFinish() result");
+            break;
+        }
+    }
+    auto const allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+
+    auto const edgeCount = static_cast<double>(prerequisites.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(prerequisites.size()));
+    state.counters["time/edge"] = benchmark::Counter(
+        edgeCount
+        , benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+    );
+    state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    state.counters["peak_rss_MB"] = static_cast<double>(usage.ru_maxrss) / 1024.0; // ru_maxrss is in KiB.
+}
+
+/*!
+    \brief Time CSR construction alone: makeCsrGraph(), or makeCsrGraphParallel() with 'threadCount' threads.
+
+    threadCount == 0 selects the sequential builder.
+*/
+void
+BM_BuildCsrGraph(benchmark::State& state, unsigned threadCount) {
+    auto const& catalog = workload(workload_kind_t::sparseDag, static_cast<int>(state.range(0)));
+    auto const prerequisites = std::span<std::pair<int, int> const>{catalog.prerequisites};
+    for (auto _ : state) {
+        auto const graph = 0 == threadCount
+            ? makeCsrGraph(catalog.numCourses, prerequisites)
+            : makeCsrGraphParallel(catalog.numCourses, prerequisites, threadCount);
+        benchmark::DoNotOptimize(graph.targets.data());
+    }
+    state.counters["time/edge"] = benchmark::Counter(
+        static_cast<double>(prerequisites.size())
+        , benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+    );
+}
+
+//! Register one engine on every workload shape.
+template <typename Engine>
+void
+registerEngine(char const* name, int64_t maxEdgeCount) {
+    auto const add = [&](char const* workloadName, auto benchmarkFn) {
+        benchmark::RegisterBenchmark((std::string{name} + "/" + workloadName).c_str(), benchmarkFn)
+            ->RangeMultiplier(10)
+            ->Range(1'000, maxEdgeCount)
+            ->Unit(benchmark::kMillisecond);
+    };
+    add("Chain", BM_CanFinish<Engine, workload_kind_t::chain>);
+    add("WideDag", BM_CanFinish<Engine, workload_kind_t::wideDag>);
+    add("SparseDag", BM_CanFinish<Engine, workload_kind_t::sparseDag>);
+    add("DenseDag", BM_CanFinish<Engine, workload_kind_t::denseDag>);
+    add("LateCycle", BM_CanFinish<Engine, workload_kind_t::lateCycle>);
+}
+
+} // namespace {
+
+int
+main(int argc, char** argv) {
+    // Solution1_DFS recurses once per chain link; past ~10^4 deep it overflows the default stack.
+    registerEngine<Solution1_DFS>("Solution1_DFS", 10'000);
+    registerEngine<Solution2_TopologicalSort>("Solution2_TopologicalSort", 10'000'000);
+    registerEngine<Solution3_IterativeDFS>("Solution3_IterativeDFS", 10'000'000);
+    registerEngine<Solution4_ParallelTopologicalSort>("Solution4_ParallelTopologicalSort", 10'000'000);
+    registerEngine<Solution5_TarjanSCC>("Solution5_TarjanSCC", 10'000'000);
+    registerEngine<Prechecked<Solution2_TopologicalSort>>("Prechecked<Solution2_TopologicalSort>", 10'000'000);
+    // Rows are V^2 / 8 bytes, so stay at catalogs of a few ten thousand courses.
+    registerEngine<Solution6_BitsetReachability>("Solution6_BitsetReachability", 10'000);
+    registerEngine<Solution7_ParallelDFS>("Solution7_ParallelDFS", 10'000'000);
+
+    for (auto const threadCount : {0u, 2u, 4u, std::thread::hardware_concurrency()}) {
+        auto const name = 0 == threadCount
+            ? std::string{"BuildCsrGraph/Sequential"}
+            : "BuildCsrGraph/Parallel" + std::to_string(threadCount);
+        benchmark::RegisterBenchmark(name.c_str(), BM_BuildCsrGraph, threadCount)
+            ->RangeMultiplier(10)
+            ->Range(100'000, 10'000'000)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+
+/*
+    End of "benchmark.cpp"
+*/
@@ -0,0 +1,83 @@
+/*!
+    \file "compact_catalog.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Remap sparse course ids on to a dense 0 .. k-1 range before building a CSR graph.
+*/
+
+#include "compact_catalog.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+
+/*!
+    \brief Insert-only open addressing map from course id to dense course.
+
+    Capacity is a power of two at least twice the number of keys, so probe
+    sequences stay short.  A slot is empty while its dense course is -1.
+*/
+class dense_id_map_t {
+    struct slot_t {
+        std::int64_t id{};
+        int course{-1};
+    };
+
+    std::vector<slot_t> slots_{};
+    std::size_t mask_{};
+
+    //! splitmix64 finalizer: spreads clustered or strided ids over the whole table.
+    static std::size_t hash(std::int64_t id) noexcept {
+        auto bits = static_cast<std::uint64_t>(id);
+        bits = (bits ^ (bits >> 30)) * 0xBF58476D1CE4E5B9ull;
+        bits = (bits ^ (bits >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::size_t>(bits ^ (bits >> 31));
+    }
+
+public:
+    explicit dense_id_map_t(std::size_t maxKeyCount)
+        : slots_(std::bit_ceil((std::max)(std::size_t{2}, 2 * maxKeyCount)))
+        , mask_{slots_.size() - 1}
+    {}
+
+    //! Return the dense course of 'id', assigning ids.size() (and appending 'id' to 'ids') when it is new.
+    int denseCourse(std::int64_t id, std::vector<std::int64_t>& ids) {
+        for (auto slotIdx = hash(id) & mask_; ; slotIdx = (slotIdx + 1) & mask_) {
+            auto& slot = slots_[slotIdx];
+            if (-1 == slot.course) {
+                slot = {id, static_cast<int>(ids.size())};
+                ids.push_back(id);
+                return slot.course;
+            }
+            if (id == slot.id) {
+                return slot.course;
+            }
+        }
+    }
+};
+
+} // namespace {
+
+compact_catalog_t
+compactCatalog(std::span<std::pair<std::int64_t, std::int64_t> const> prerequisites) {
+    compact_catalog_t catalog{};
+    dense_id_map_t denseIds{2 * prerequisites.size()};
+
+    std::vector<std::pair<int, int>> edges{};
+    edges.reserve(prerequisites.size());
+    for (auto const& [course, prerequisite] : prerequisites) {
+        auto const denseCourse = denseIds.denseCourse(course, catalog.ids);
+        edges.emplace_back(denseCourse, denseIds.denseCourse(prerequisite, catalog.ids));
+    }
+
+    assignCsrGraph(catalog.graph, static_cast<int>(catalog.ids.size()), std::span<std::pair<int, int> const>{edges});
+    return catalog;
+}
+
+/*
+    End of "compact_catalog.cpp"
+*/
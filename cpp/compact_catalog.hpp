@@ -0,0 +1,52 @@
+/*!
+    \file "compact_catalog.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Remap sparse course ids on to a dense 0 .. k-1 range before building a CSR graph.
+*/
+
+#ifndef COMPACT_CATALOG_HPP_E0337396_729A_4961_9E0E_1229AB704134
+#define COMPACT_CATALOG_HPP_E0337396_729A_4961_9E0E_1229AB704134
+#pragma once
+
+#include "csr_graph.hpp"
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+/*!
+    \brief Prerequisite graph over only the courses that appear in a prerequisite.
+
+    Course 'c' of 'graph' is the course with id ids[c].  Every engine accepts
+    the graph (as a csr_graph_view_t), and an order or cycle it returns maps
+    back to course ids through 'ids'.  Courses without prerequisites and that
+    no course requires can't be part of a cycle, so they are left out.
+*/
+struct compact_catalog_t
+{
+    std::vector<std::int64_t> ids{}; //!< Dense course -> course id, in order of first appearance.
+    csr_graph_t graph{};
+};
+
+/*!
+    \brief Remap the course ids in 'prerequisites' = [(ai, bi), ...] to 0 .. k-1 and build the CSR graph.
+
+    Ids are looked up in an open addressing (linear probing) hash table sized
+    for every endpoint, so time and memory are O(E) however large or sparse
+    the ids are.
+*/
+compact_catalog_t
+compactCatalog(std::span<std::pair<std::int64_t, std::int64_t> const> prerequisites);
+
+#endif // #ifndef COMPACT_CATALOG_HPP_E0337396_729A_4961_9E0E_1229AB704134
+
+/*
+    End of "compact_catalog.hpp"
+*/
@@ -0,0 +1,81 @@
+/*!
+    \file "convert.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Convert leetcode style prerequisite text ("[[1,0],[0,1]]") to a binary prerequisite file.
+
+    Usage: leetcode_convert <input.txt> <output.bin> [--courses <numCourses>] [--csr]
+
+    numCourses defaults to the largest course id + 1.  --csr also stores the
+    prebuilt CSR graph so loading needs no graph construction.
+*/
+
+#include "prerequisite_file.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+int
+main(int argc, char** argv) {
+    try {
+        std::string inputPath{};
+        std::string outputPath{};
+        int numCourses = -1;
+        bool withCsr = false;
+        for (int argIdx = 1; argc > argIdx; ++argIdx) {
+            std::string const arg{argv[argIdx]};
+            if ("--csr" == arg) {
+                withCsr = true;
+            } else if ("--courses" == arg && argc > argIdx + 1) {
+                numCourses = std::stoi(argv[++argIdx]);
+            } else if (inputPath.empty()) {
+                inputPath = arg;
+            } else if (outputPath.empty()) {
+                outputPath = arg;
+            } else {
+                inputPath.clear();
+                break;
+            }
+        }
+        if (inputPath.empty() || outputPath.empty()) {
+            std::cerr << "Usage: " << argv[0] << " <input.txt> <output.bin> [--courses <numCourses>] [--csr]\n";
+            return 2;
+        }
+
+        std::ifstream input{inputPath};
+        if (!input) {
+            std::cerr << "Cannot read " << inputPath << '\n';
+            return 1;
+        }
+        std::stringstream text{};
+        text << input.rdbuf();
+
+        auto const prerequisites = parsePrerequisiteText(text.str());
+        if (-1 == numCourses) {
+            numCourses = 0;
+            for (auto const& [course, prerequisite] : prerequisites) {
+                numCourses = (std::max)({numCourses, course + 1, prerequisite + 1});
+            }
+        }
+
+        writePrerequisiteFile(outputPath, numCourses, prerequisites, withCsr);
+        std::cerr << "Wrote " << prerequisites.size() << " prerequisites for " << numCourses << " courses to "
+                  << outputPath << '\n';
+    } catch (std::exception const& error) {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+    End of "convert.cpp"
+*/
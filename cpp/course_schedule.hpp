@@ -0,0 +1,1757 @@
+/*!
+    \file "course_schedule.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    https://leetcode.com/problems/course-schedule/
+
+    Course schedule engines, shared by the tests and the benchmarks.
+*/
+
+#ifndef COURSE_SCHEDULE_HPP_BD4C5751_6CD7_4ADA_A8D6_689B6B6CFBDD
+#define COURSE_SCHEDULE_HPP_BD4C5751_6CD7_4ADA_A8D6_689B6B6CFBDD
+#pragma once
+
+#include "csr_graph.hpp"
+#include "instrumentation.hpp"
+#include "precheck.hpp"
+#include "utils.hpp"
+
+/*
+    There are a total of numCourses courses you have to take, labeled from 
+    0 to numCourses - 1. You are given an array prerequisites where 
+    prerequisites[i] = [ai, bi] indicates that you must take course bi first 
+    if you want to take course ai.
+
+        * For example, the pair [0, 1], indicates that to take course 0 you 
+          have to first take course 1.
+    
+    Return true if you can finish all courses. Otherwise, return false.
+
+    Constraints:
+
+        * 1 <= numCourses <= 2000
+        * 0 <= prerequisites.length <= 5000
+        * prerequisites[i].length == 2
+        * 0 <= ai, bi < numCourses
+        * All the pairs prerequisites[i] are unique.
+*/
+
+/*!
+    \brief Size of a per-call arena (std::pmr::monotonic_buffer_resource) for a catalog.
+
+    Covers the CSR graph plus 'bytesPerCourse' of engine scratch per course,
+    so one upstream allocation serves the whole call and the arena releases
+    everything at once when it goes out of scope.  Underestimates only cost
+    additional (geometrically growing) upstream blocks.
+*/
+inline size_t
+arenaBytes(int numCourses, size_t edgeCount, size_t bytesPerCourse) {
+    auto const courseCount = static_cast<size_t>((max)(0, numCourses));
+    return (courseCount + 2 + edgeCount) * sizeof(int) + courseCount * bytesPerCourse + 256;
+}
+
+class Solution1_DFS {
+        using courses_t = csr_graph_view_t;
+        using visited_t = pmr::unordered_set<int>;
+        using finished_t = pmr::vector<bool>;
+
+        //! Arena bytes per course: a visited set node, its share of the buckets, and a finished flag.
+        static constexpr size_t scratchBytesPerCourse = 64;
+
+        static bool canFinishDFS(
+            courses_t const& courses
+            , int course
+            , visited_t& visited
+            , finished_t& finished
+        ) noexcept {
+            if (visited.contains(course)) { return false; }
+            if (finished[static_cast<size_t>(course)]) { return true; }
+            
+            auto const dependencies = courses.neighbors(course);
+            COURSE_SCHEDULE_COUNT(nodesVisited, 1);
+            if (!dependencies.empty()) {
+                visited.insert(course);
+                COURSE_SCHEDULE_HIGH_WATER(maxDepth, visited.size());
+
+                for (auto const dependency : dependencies) {
+                    COURSE_SCHEDULE_COUNT(edgesScanned, 1);
+                    if (!canFinishDFS(courses, dependency, visited, finished)) {
+                        return false;
+                    }
+                }
+
+                visited.erase(course);
+            }
+
+            finished[static_cast<size_t>(course)] = true;
+            
+            return true;
+        }
+
+public:
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+        
+        Populate a CSR graph with all courses.  Row 'course' holds every
+        prerequisites[1] whose prerequisites[0] is 'course', which handles
+        courses with more than one prerequisite.  Use a recursive depth
+        first search to visit each individual branch of the prerequisite
+        tree.  Mark the branch (or sub-branch) finished after visiting it
+        so it is never visited again (DP).  As each node in the branch is
+        visited, check to see if it was already visited.  If it was then
+        there is a cyclic dependency in the branch, which results in false
+        being returned.  Add branch nodes to the visited collection as the
+        branch is traversed from root to tip and remove the added nodes as
+        the stack unwinds back from tip to root (backtracking).
+
+        Time = O(V + E)
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+               Prerequisite tree branch nodes are marked finished after
+               being visited, so each node and edge is visited at most once.
+
+        Space = O(V + E)
+                V = finished flags, CSR row offsets, and the maximum call
+                    stack depth when all prerequisites reference each
+                    other and create a linear chain.
+                E = CSR edge targets.
+
+        The graph, the visited set, and the finished flags all come from one
+        per-call arena (see arenaBytes()), so the visited set's node
+        allocations never reach the global heap.
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size(), scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        csr_graph_t courses{&arena};
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(courses, numCourses, prerequisites);
+        }
+        return canFinish(courses, &arena);
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size(), scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        csr_graph_t courses{&arena};
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(courses, numCourses, prerequisites);
+        }
+        return canFinish(courses, &arena);
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size() / 2, scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        csr_graph_t courses{&arena};
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(courses, numCourses, prerequisites);
+        }
+        return canFinish(courses, &arena);
+    }
+
+    bool canFinish(courses_t const& courses) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(courses.nodeCount(), 0, scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        return canFinish(courses, &arena);
+    }
+
+    //! Allocate the search state from 'resource', e.g. a caller's arena.
+    bool canFinish(courses_t const& courses, pmr::memory_resource* resource) {
+        COURSE_SCHEDULE_TIME_SCOPE(traversalNanoseconds);
+        auto const numCourses = courses.nodeCount();
+
+        visited_t visited{resource};
+        finished_t finished(static_cast<size_t>(numCourses), false, resource);
+        for (int course = 0; numCourses > course; ++course) {
+            if (!canFinishDFS(courses, course, visited, finished)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+class Solution2_TopologicalSort {
+    //! Arena bytes per course: an in-degree count and a que slot.
+    static constexpr size_t scratchBytesPerCourse = 2 * sizeof(int);
+
+public:
+    /*!
+        \brief Reusable buffers for canFinish().
+
+        Holds the CSR graph(s), the in-degree counts, and the queue.  Buffers are
+        resized, never shrunk, by each call, so once a workspace has handled
+        the largest catalog, repeated canFinish() calls allocate nothing.
+        Everything lives on the heap, so catalog size is not limited by the
+        call stack.  The buffers draw from 'resource', e.g. a per-call arena.
+    */
+    class Workspace {
+    public:
+        Workspace() = default;
+
+        explicit Workspace(pmr::memory_resource* resource)
+            : graph{resource}, dependents{resource}, inDegrees{resource}, que{resource} {}
+
+        //! Size the in-degree counts and the queue for 'numCourses' courses.
+        void reset(int numCourses) {
+            inDegrees.resize(static_cast<size_t>(numCourses));
+            que.resize(static_cast<size_t>(numCourses));
+        }
+
+    private:
+        friend class Solution2_TopologicalSort;
+
+        csr_graph_t graph{};
+        csr_graph_t dependents{}; //!< graph reversed (prerequisite -> course); only planSemesters() builds it.
+        pmr::vector<int> inDegrees{};
+
+        // Each node is pushed at most once, so a numCourses sized buffer
+        // indexed by a head (pop) and tail (push) cursor never wraps.
+        pmr::vector<int> que{};
+    };
+
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+        
+        Use a topological sort to detect cycles.
+          1) Create a CSR graph (adjacency list) from the prerequisites.
+          2) Count the number of edges coming in to a node (it's in-degree).
+          3) Push the nodes with an in-degree of zero (0) on to the que.
+          4) While the queue is not empty:
+        4.1)   Pop node ('A') off of que.
+        4.2)   Decrement the in-degree of each node referenced by 'A', i.e.
+               each node that can be reached by following an edge from 'A'.
+        4.3)   If the in-degree of a node becomes zero (0), push the node 
+               on to the que.
+          5) If the number of nodes pushed to or popped from the que is equal
+             to the number of nodes in the graph then there are no cycles in
+             the dependency tree and the result is true.
+
+        Time = O(V + V + 2E + E + V + V) => O(4V + 3E) => O(V+E)
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+               Term 1: inDegrees allocation.
+               Term 2: graph allocation.
+               Term 3: graph population (count pass + scatter pass).
+               Term 4: inDegrees population.
+               Term 5: queue initialization.
+               Term 6: queue processing.
+
+        Space = O(V + (V + E) + V) => O(3V + E) => O(V+E)
+                V = vertex count == numCourses
+                E = edge count == len(prerequisites)
+                Term 1: inDegrees capacity
+                Term 2: graph capacity (CSR row offsets + edge targets).
+                Term 3: queue capacity (all nodes when none reference any other).
+
+        Without a caller supplied Workspace, all three live in one per-call
+        arena (see arenaBytes()).
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size(), scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        Workspace workspace{&arena};
+        return canFinish(numCourses, prerequisites, workspace);
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size(), scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        Workspace workspace{&arena};
+        return canFinish(numCourses, prerequisites, workspace);
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size() / 2, scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        Workspace workspace{&arena};
+        return canFinish(numCourses, prerequisites, workspace);
+    }
+
+    bool canFinish(csr_graph_view_t graph) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(graph.nodeCount(), 0, scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        Workspace workspace{&arena};
+        return canFinish(graph, workspace);
+    }
+
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites, Workspace& workspace) {
+        // Create graph [adjacency list] from prerequisites.
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(workspace.graph, numCourses, prerequisites);
+        }
+        return canFinish(workspace.graph, workspace);
+    }
+
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites, Workspace& workspace) {
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(workspace.graph, numCourses, prerequisites);
+        }
+        return canFinish(workspace.graph, workspace);
+    }
+
+    bool canFinish(int numCourses, span<int const> prerequisites, Workspace& workspace) {
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(workspace.graph, numCourses, prerequisites);
+        }
+        return canFinish(workspace.graph, workspace);
+    }
+
+    bool canFinish(csr_graph_view_t graph, Workspace& workspace) {
+        auto const visitCount = sortTopologically(graph, workspace);
+        auto const noCycleDetected = visitCount == graph.nodeCount();
+        return noCycleDetected;
+    }
+
+    /*
+        Return the courses in an order in which they can be taken, i.e. each
+        course after all of its prerequisites, or an empty array when there
+        is a cyclic dependency.
+
+        The order falls out of the same topological sort canFinish() runs:
+        the que holds every course after all of the courses that depend on
+        it, so the que read back to front is a valid course order.
+
+        Time = O(V + E)
+        Space = O(V + E)
+    */
+    vector<int> findOrder(int numCourses, vector<vector<int>>& prerequisites) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, prerequisites.size(), scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        Workspace workspace{&arena};
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(workspace.graph, numCourses, prerequisites);
+        }
+        return findOrder(workspace.graph, workspace);
+    }
+
+    vector<int> findOrder(csr_graph_view_t graph, Workspace& workspace) {
+        auto const visitCount = sortTopologically(graph, workspace);
+        if (visitCount != graph.nodeCount()) {
+            return {};
+        }
+
+        auto const que = span<int const>{workspace.que}.first(static_cast<size_t>(visitCount));
+        return vector<int>(que.rbegin(), que.rend());
+    }
+
+    //! Outcome of planSemesters().
+    struct semester_plan_t {
+        bool canFinish{};
+        vector<int> levels{}; //!< course -> longest prerequisite chain below it == earliest possible semester.
+        int criticalPathLength{}; //!< Semesters needed without a course cap (max level + 1).
+        vector<int> semesters{}; //!< course -> semester assigned under the course cap.
+        int semesterCount{}; //!< Semesters used under the course cap.
+    };
+
+    /*
+        Plan the semesters in the same Kahn pass that decides canFinish().
+
+        The topological sort runs over the reversed graph (prerequisite ->
+        course), so the que starts with the courses that have no
+        prerequisites and a course's in-degree is its number of prerequisites
+        still to take.  The que is consumed one semester at a time:
+          1) A semester takes at most 'maxCoursesPerSemester' of the courses
+             that were ready when it started, in que order.
+          2) Taking a course raises the level of each dependent course to at
+             least level + 1 and decrements its in-degree; a dependent that
+             reaches zero is appended to the que, so it is ready from the
+             next semester on.
+        The levels are the semesters of an uncapped plan, so the critical
+        path length is the largest level + 1.  The capped assignment is a
+        greedy list schedule: valid, but not always the shortest possible.
+        All outputs are empty when there is a cyclic dependency.
+
+        Time = O(V + E)
+        Space = O(V + E)
+    */
+    semester_plan_t planSemesters(int numCourses, vector<vector<int>>& prerequisites, int maxCoursesPerSemester) {
+        pmr::monotonic_buffer_resource arena{
+            arenaBytes(numCourses, 2 * prerequisites.size(), scratchBytesPerCourse)
+            , engineUpstreamResource()
+        };
+        Workspace workspace{&arena};
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignCsrGraph(workspace.graph, numCourses, prerequisites);
+        }
+        return planSemesters(workspace.graph, maxCoursesPerSemester, workspace);
+    }
+
+    semester_plan_t planSemesters(csr_graph_view_t graph, int maxCoursesPerSemester, Workspace& workspace) {
+        assert(0 < maxCoursesPerSemester);
+        auto const numCourses = graph.nodeCount();
+        workspace.reset(numCourses);
+        {
+            COURSE_SCHEDULE_TIME_SCOPE(buildNanoseconds);
+            assignReversedCsrGraph(workspace.dependents, graph);
+        }
+        COURSE_SCHEDULE_TIME_SCOPE(traversalNanoseconds);
+        csr_graph_view_t const dependents = workspace.dependents;
+
+        semester_plan_t plan{};
+        plan.levels.assign(static_cast<size_t>(numCourses), 0);
+        plan.semesters.assign(static_cast<size_t>(numCourses), -1);
+
+        // In-degree over the reversed graph == prerequisite count == row length in 'graph'.
+        auto& inDegrees = workspace.inDegrees;
+        auto& que = workspace.que;
+        size_t queHead = 0;
+        size_t queTail = 0;
+        for (int course = 0; numCourses > course; ++course) {
+            auto const prerequisiteCount = graph.offsets[static_cast<size_t>(course) + 1]
+                - graph.offsets[static_cast<size_t>(course)];
+            inDegrees[static_cast<size_t>(course)] = prerequisiteCount;
+            if (0 == prerequisiteCount) {
+                que[queTail++] = course;
+            }
+        }
+
+        auto const cap = static_cast<size_t>(maxCoursesPerSemester);
+        for (int semester = 0; queHead != queTail; ++semester) {
+            COURSE_SCHEDULE_HIGH_WATER(queueHighWater, queTail - queHead);
+            auto const semesterEnd = (min)(queTail, queHead + cap);
+            for (; semesterEnd != queHead; ++queHead) {
+                auto const course = que[queHead];
+                auto const level = plan.levels[static_cast<size_t>(course)];
+                plan.semesters[static_cast<size_t>(course)] = semester;
+                plan.criticalPathLength = (max)(plan.criticalPathLength, level + 1);
+                COURSE_SCHEDULE_COUNT(nodesVisited, 1);
+                COURSE_SCHEDULE_COUNT(edgesScanned, dependents.neighbors(course).size());
+                for (auto const dependent : dependents.neighbors(course)) {
+                    auto& dependentLevel = plan.levels[static_cast<size_t>(dependent)];
+                    dependentLevel = (max)(dependentLevel, level + 1);
+                    if (0 == --inDegrees[static_cast<size_t>(dependent)]) {
+                        que[queTail++] = dependent;
+                    }
+                }
+            }
+            plan.semesterCount = semester + 1;
+        }
+
+        plan.canFinish = static_cast<int>(queTail) == numCourses;
+        if (!plan.canFinish) {
+            return {};
+        }
+
+        return plan;
+    }
+
+    /*
+        Compile time canFinish() for catalogs fixed in the source, e.g.
+
+            constexpr auto catalog = array<pair<int, int>, 1>{{{1, 0}}};
+            static_assert(Solution2_TopologicalSort::canFinish<2>(catalog));
+
+        Builds a static_csr_graph_t and runs the same topological sort core
+        as the runtime overloads, with the in-degree counts and the que in
+        std::arrays, so a valid catalog costs nothing at run time and an
+        invalid one fails the build.
+
+        Time = O(V + E) constant evaluation steps
+        Space = O(V + E)
+    */
+    template <size_t CourseCount, size_t PrerequisiteCount>
+    static constexpr bool canFinish(array<pair<int, int>, PrerequisiteCount> const& prerequisites) {
+        auto const graph = makeStaticCsrGraph<CourseCount>(prerequisites);
+        array<int, CourseCount> inDegrees{};
+        array<int, CourseCount> que{};
+        return static_cast<int>(CourseCount) == sortTopologically(graph, inDegrees, que);
+    }
+
+private:
+    /*!
+        \brief Run the topological sort and return the number of nodes visited.
+
+        On return workspace.que[0 .. visitCount) holds the visited nodes in the
+        order they were pushed on to the que.
+    */
+    static int sortTopologically(csr_graph_view_t graph, Workspace& workspace) {
+        COURSE_SCHEDULE_TIME_SCOPE(traversalNanoseconds);
+        workspace.reset(graph.nodeCount());
+        return sortTopologically(graph, workspace.inDegrees, workspace.que);
+    }
+
+    /*!
+        \brief Topological sort core shared by the runtime and the constexpr entry points.
+
+        'inDegrees' and 'que' must hold at least graph.nodeCount() entries;
+        their contents on entry don't matter.
+    */
+    static constexpr int sortTopologically(csr_graph_view_t graph, span<int> inDegrees, span<int> que) {
+        auto const numCourses = graph.nodeCount();
+        assert(static_cast<size_t>(numCourses) <= inDegrees.size());
+        assert(static_cast<size_t>(numCourses) <= que.size());
+
+        // Create in-degree counts from graph.
+        fill(inDegrees.begin(), inDegrees.begin() + numCourses, 0);
+        for (auto const target : graph.targets) {
+            ++inDegrees[static_cast<size_t>(target)];
+        }
+
+        // Initialize queue with nodes that have an in-degree count of zero.
+        size_t queHead = 0;
+        size_t queTail = 0;
+        for (int node = 0; numCourses > node; ++node) {
+            if (0 == inDegrees[static_cast<size_t>(node)]) {
+                que[queTail++] = node;
+            }
+        }
+
+        // Remove each node from graph until all removed or cycle detected.
+        while (queHead != queTail) {
+            COURSE_SCHEDULE_HIGH_WATER(queueHighWater, queTail - queHead);
+            auto const node = que[queHead++];
+            COURSE_SCHEDULE_COUNT(nodesVisited, 1);
+
+            // "Remove" node from graph.
+            COURSE_SCHEDULE_COUNT(edgesScanned, graph.neighbors(node).size());
+            for (auto const neighbor : graph.neighbors(node)) {
+                if (0 == --inDegrees[static_cast<size_t>(neighbor)]) {
+                    que[queTail++] = neighbor;
+                }
+            }
+        }
+
+        // Every node that was ever pushed on to the que was visited.
+        return static_cast<int>(queTail);
+    }
+};
+
+class Solution3_IterativeDFS {
+        enum color_t : uint8_t { white = 0, gray = 1, black = 2 };
+        using colors_t = vector<uint8_t>;
+
+        struct frame_t {
+            int course{}; //!< Course being expanded.
+            int nextEdge{}; //!< Index (in courses.targets) of the next dependency to visit.
+        };
+        using stack_t = vector<frame_t>;
+
+public:
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+
+        Same depth first search as Solution1_DFS, but the call stack is
+        replaced by an explicit stack and the hashed visited set by a dense
+        per-course color:
+          * white: not visited yet.
+          * gray:  on the current branch (root to tip).
+          * black: branch fully visited and free of cycles (DP).
+        Each stack frame remembers the next dependency edge to follow, so a
+        course is expanded exactly once.  Reaching a gray course means the
+        branch loops back on itself, which is a cyclic dependency.
+
+        Time = O(V + E)
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+               Each course turns gray and black exactly once and each edge
+               is followed exactly once.
+
+        Space = O(V + E)
+                V = colors, CSR row offsets, and the explicit stack when all
+                    prerequisites create a linear chain.  The stack lives on
+                    the heap so chain depth is not bounded by the call stack.
+                E = CSR edge targets.
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    bool canFinish(csr_graph_view_t courses) {
+        return search(courses, nullptr, nullptr);
+    }
+
+    //! Outcome of findOrderOrCycle().
+    struct schedule_t {
+        bool canFinish{};
+        vector<int> order{}; //!< When canFinish: every course, each after all of its prerequisites.
+        vector<int> cycle{}; //!< When !canFinish: cycle[i] requires cycle[i + 1] and the last requires cycle[0].
+    };
+
+    /*
+        Return either an order in which all courses can be taken or a
+        concrete cyclic dependency, from the same single search canFinish()
+        runs.
+
+        A course turns black only after all of its prerequisites turned
+        black, so appending courses as they turn black yields a valid course
+        order.  When a gray course is reached again, the stack frames from
+        that course to the tip of the branch are exactly the cycle.
+
+        Time = O(V + E)
+        Space = O(V + E)
+    */
+    schedule_t findOrderOrCycle(int numCourses, vector<vector<int>>& prerequisites) {
+        return findOrderOrCycle(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    schedule_t findOrderOrCycle(csr_graph_view_t courses) {
+        schedule_t schedule{};
+        schedule.order.reserve(static_cast<size_t>(courses.nodeCount()));
+        schedule.canFinish = search(courses, &schedule.order, &schedule.cycle);
+        if (!schedule.canFinish) {
+            schedule.order.clear();
+        }
+        return schedule;
+    }
+
+private:
+    /*!
+        \brief Depth first search of every branch.
+
+        Optionally records retired courses in 'order' and, when a cyclic
+        dependency is found, the courses forming it in 'cycle'.
+    */
+    static bool search(csr_graph_view_t courses, vector<int>* order, vector<int>* cycle) {
+        auto const numCourses = courses.nodeCount();
+
+        colors_t colors(static_cast<size_t>(numCourses), white);
+        stack_t stack{};
+        for (int root = 0; numCourses > root; ++root) {
+            if (white != colors[static_cast<size_t>(root)]) { continue; }
+
+            colors[static_cast<size_t>(root)] = gray;
+            stack.push_back({root, courses.offsets[static_cast<size_t>(root)]});
+            while (!stack.empty()) {
+                auto& frame = stack.back();
+                if (courses.offsets[static_cast<size_t>(frame.course) + 1] == frame.nextEdge) {
+                    // All dependencies visited: retire the course.
+                    colors[static_cast<size_t>(frame.course)] = black;
+                    if (order) { order->push_back(frame.course); }
+                    stack.pop_back();
+                    continue;
+                }
+
+                auto const dependency = courses.targets[static_cast<size_t>(frame.nextEdge++)];
+                auto& color = colors[static_cast<size_t>(dependency)];
+                if (gray == color) {
+                    if (cycle) {
+                        // The branch from 'dependency' to the tip loops back to 'dependency'.
+                        auto const cycleStart = find_if(
+                            stack.rbegin()
+                            , stack.rend()
+                            , [&](frame_t const& candidate) { return dependency == candidate.course; }
+                        ).base() - 1;
+                        for (auto iter = cycleStart; stack.end() != iter; ++iter) {
+                            cycle->push_back(iter->course);
+                        }
+                    }
+                    return false;
+                }
+                if (white == color) {
+                    color = gray;
+                    stack.push_back({dependency, courses.offsets[static_cast<size_t>(dependency)]});
+                }
+            }
+        }
+
+        return true;
+    }
+};
+
+class Solution4_ParallelTopologicalSort {
+        using frontier_t = vector<int>;
+
+        //! Frontiers smaller than this are expanded by a single thread.
+        static constexpr size_t parallelGrain = 1024;
+
+        unsigned threadCount_{};
+
+        //! Expand 'frontier' in place, one level at a time, until it is empty or at least 'maxWidth' wide.
+        static void expandSerially(
+            csr_graph_view_t graph
+            , vector<int>& inDegrees
+            , frontier_t& frontier
+            , frontier_t& next
+            , int& visitCount
+            , size_t maxWidth
+        ) {
+            while (!frontier.empty() && maxWidth > frontier.size()) {
+                next.clear();
+                for (auto const node : frontier) {
+                    for (auto const neighbor : graph.neighbors(node)) {
+                        if (0 == --inDegrees[static_cast<size_t>(neighbor)]) {
+                            next.push_back(neighbor);
+                        }
+                    }
+                }
+                visitCount += static_cast<int>(next.size());
+                frontier.swap(next);
+            }
+        }
+
+public:
+    explicit Solution4_ParallelTopologicalSort(unsigned threadCount = thread::hardware_concurrency())
+        : threadCount_{(max)(1u, threadCount)} {}
+
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+
+        Same topological sort as Solution2_TopologicalSort, but the que is
+        processed one frontier (level) at a time and each level is split
+        across threads:
+          1) Create a CSR graph with makeCsrGraphParallel() and the in-degree
+             counts from the prerequisites.
+          2) The first frontier is every node with an in-degree of zero (0).
+          3) While the frontier is not empty:
+        3.1)   Each thread takes a contiguous slice of the frontier and
+               atomically decrements the in-degree of every node referenced
+               by its nodes.  The thread that drops an in-degree to zero (0)
+               appends that node to its own next-frontier buffer, so no
+               locks are needed.
+        3.2)   At the level barrier the per-thread buffers are concatenated
+               into the next frontier.
+          4) If the number of nodes that entered a frontier is equal to the
+             number of nodes in the graph then there are no cycles.
+        Narrow levels (deep chains) are expanded by one thread without
+        synchronization until the frontier is wide enough to split again.
+
+        Time = O((V + E) / T + L)
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+               T = thread count
+               L = number of levels wide enough to be split (one barrier each).
+
+        Space = O(V + E)
+                V = inDegrees, CSR row offsets, and frontiers.
+                E = CSR edge targets.
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        return canFinish(makeCsrGraphParallel(numCourses, prerequisites, threadCount_));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        return canFinish(makeCsrGraphParallel(numCourses, prerequisites, threadCount_));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        return canFinish(makeCsrGraphParallel(numCourses, prerequisites, threadCount_));
+    }
+
+    bool canFinish(csr_graph_view_t graph) {
+        auto const numCourses = graph.nodeCount();
+
+        // Create in-degree counts from graph.
+        vector<int> inDegrees(static_cast<size_t>(numCourses), 0);
+        for (auto const target : graph.targets) {
+            ++inDegrees[static_cast<size_t>(target)];
+        }
+
+        // Every node enters a frontier at most once, so reserving both frontier buffers for all of them up
+        // front means the merge below (a noexcept barrier completion) never allocates.
+        frontier_t frontier{};
+        frontier_t scratch{};
+        frontier.reserve(static_cast<size_t>(numCourses));
+        scratch.reserve(static_cast<size_t>(numCourses));
+
+        // Initialize frontier with nodes that have an in-degree count of zero.
+        for (int node = 0; numCourses > node; ++node) {
+            if (0 == inDegrees[static_cast<size_t>(node)]) {
+                frontier.push_back(node);
+            }
+        }
+
+        int visitCount = static_cast<int>(frontier.size());
+        auto const maxSerialWidth = 1 == threadCount_ ? (numeric_limits<size_t>::max)() : parallelGrain;
+        expandSerially(graph, inDegrees, frontier, scratch, visitCount, maxSerialWidth);
+        if (frontier.empty()) {
+            return visitCount == numCourses;
+        }
+
+        // Merge the per-thread buffers into the next frontier at each level
+        // barrier; runs on one thread while the others wait.  Both buffers it
+        // fills were reserved for every node above, so it cannot throw.
+        vector<frontier_t> nextFrontiers(threadCount_);
+        auto const mergeFrontiers = [&]() noexcept {
+            frontier.clear();
+            for (auto& next : nextFrontiers) {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+                next.clear();
+            }
+            visitCount += static_cast<int>(frontier.size());
+            expandSerially(graph, inDegrees, frontier, scratch, visitCount, maxSerialWidth);
+        };
+        barrier levelBarrier{static_cast<ptrdiff_t>(threadCount_), mergeFrontiers};
+
+        auto const worker = [&](unsigned threadIdx) {
+            auto& next = nextFrontiers[threadIdx];
+            while (!frontier.empty()) {
+                auto const begin = frontier.size() * threadIdx / threadCount_;
+                auto const end = frontier.size() * (threadIdx + 1) / threadCount_;
+                for (auto idx = begin; end > idx; ++idx) {
+                    for (auto const neighbor : graph.neighbors(frontier[idx])) {
+                        atomic_ref<int> inDegree{inDegrees[static_cast<size_t>(neighbor)]};
+                        if (1 == inDegree.fetch_sub(1, memory_order_relaxed)) {
+                            next.push_back(neighbor);
+                        }
+                    }
+                }
+                levelBarrier.arrive_and_wait();
+            }
+        };
+
+        {
+            vector<jthread> threads{};
+            threads.reserve(threadCount_ - 1);
+            for (unsigned threadIdx = 1; threadCount_ > threadIdx; ++threadIdx) {
+                threads.emplace_back(worker, threadIdx);
+            }
+            worker(0);
+        } // Join.
+
+        auto const noCycleDetected = visitCount == numCourses;
+        return noCycleDetected;
+    }
+};
+
+class Solution5_TarjanSCC {
+public:
+    //! Diagnosis of a catalog; see diagnose().
+    struct components_t {
+        vector<int> componentOf{}; //!< course -> component id.
+        csr_graph_t members{}; //!< Row 'c' lists the courses of component 'c'; row size is the component size.
+        vector<int> cyclicComponents{}; //!< Components with more than one course, or one course requiring itself.
+        csr_graph_t condensation{}; //!< Component DAG: row 'c' lists the components 'c' requires (no duplicates).
+    };
+
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+
+        Use Tarjan's algorithm to split the courses into strongly connected
+        components (SCCs): maximal sets of courses that all (transitively)
+        require each other.  The prerequisites are acyclic exactly when every
+        component is a single course that does not require itself.
+          1) Depth first search from every unvisited course, numbering courses
+             in visit order (index) and pushing them on to a component stack.
+          2) A course's lowlink is the smallest index reachable from its
+             branch through courses still on the component stack.
+          3) When a course is retired with lowlink == index it is the root of
+             a component: pop the component stack down to it.
+        The search keeps an explicit stack, like Solution3_IterativeDFS, so
+        catalog depth is not bounded by the call stack.
+
+        Time = O(V + E)
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+
+        Space = O(V + E)
+                V = index, lowlink, component ids, and both stacks.
+                E = CSR edge targets.
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    bool canFinish(csr_graph_view_t courses) {
+        vector<int> componentOf{};
+        pmr::vector<int> order{};
+        if (courses.nodeCount() != findComponents(courses, componentOf, order)) {
+            return false;
+        }
+
+        // Every component is a single course; only a self-loop can still be a cycle.
+        for (int course = 0; courses.nodeCount() > course; ++course) {
+            auto const dependencies = courses.neighbors(course);
+            if (dependencies.end() != find(dependencies.begin(), dependencies.end(), course)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+        Report every cyclic dependency at once instead of stopping at the first.
+
+        Component ids are assigned in the order Tarjan's algorithm completes
+        them, and a component completes only after every component it
+        requires, so ascending ids are already a valid order for taking the
+        components.
+
+        Time = O(V + E)
+        Space = O(V + E)
+    */
+    components_t diagnose(int numCourses, vector<vector<int>>& prerequisites) {
+        return diagnose(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    components_t diagnose(csr_graph_view_t courses) {
+        components_t components{};
+        pmr::vector<int> order{};
+        auto const componentCount = findComponents(courses, components.componentOf, order);
+
+        // Group the courses by component: 'order' already lists each component contiguously.
+        auto& members = components.members;
+        members.offsets.assign(static_cast<size_t>(componentCount) + 1, 0);
+        for (auto const component : components.componentOf) {
+            ++members.offsets[static_cast<size_t>(component) + 1];
+        }
+        partial_sum(members.offsets.begin(), members.offsets.end(), members.offsets.begin());
+        members.targets = std::move(order);
+
+        // Cyclic components and the deduplicated component DAG (two pass count/scatter).
+        auto& condensation = components.condensation;
+        condensation.offsets.assign(static_cast<size_t>(componentCount) + 1, 0);
+        vector<int> lastSeenFrom(static_cast<size_t>(componentCount), -1);
+        auto const forEachComponentEdge = [&](auto&& onEdge) {
+            for (int component = 0; componentCount > component; ++component) {
+                for (auto const course : members.neighbors(component)) {
+                    for (auto const dependency : courses.neighbors(course)) {
+                        auto const target = components.componentOf[static_cast<size_t>(dependency)];
+                        auto& seen = lastSeenFrom[static_cast<size_t>(target)];
+                        if (component != seen) {
+                            seen = component;
+                            onEdge(component, target);
+                        }
+                    }
+                }
+            }
+        };
+        forEachComponentEdge([&](int component, int target) {
+            if (component == target) {
+                components.cyclicComponents.push_back(component);
+            } else {
+                ++condensation.offsets[static_cast<size_t>(component) + 1];
+            }
+        });
+        partial_sum(condensation.offsets.begin(), condensation.offsets.end(), condensation.offsets.begin());
+
+        condensation.targets.resize(static_cast<size_t>(condensation.offsets.back()));
+        fill(lastSeenFrom.begin(), lastSeenFrom.end(), -1);
+        auto cursors = vector<int>(condensation.offsets.begin(), condensation.offsets.end() - 1);
+        forEachComponentEdge([&](int component, int target) {
+            if (component != target) {
+                condensation.targets[static_cast<size_t>(cursors[static_cast<size_t>(component)]++)] = target;
+            }
+        });
+
+        return components;
+    }
+
+private:
+    /*!
+        \brief Iterative Tarjan: fill 'componentOf' and return the component count.
+
+        'order' receives every course, grouped by component in component id order.
+    */
+    static int findComponents(csr_graph_view_t courses, vector<int>& componentOf, pmr::vector<int>& order) {
+        auto const numCourses = courses.nodeCount();
+
+        struct frame_t {
+            int course{}; //!< Course being expanded.
+            int nextEdge{}; //!< Index (in courses.targets) of the next dependency to visit.
+        };
+
+        // A course is on the component stack when it has an index but no component yet.
+        vector<int> indexes(static_cast<size_t>(numCourses), -1);
+        vector<int> lowlinks(static_cast<size_t>(numCourses), 0);
+        componentOf.assign(static_cast<size_t>(numCourses), -1);
+        order.clear();
+        order.reserve(static_cast<size_t>(numCourses));
+        vector<int> componentStack{};
+        vector<frame_t> stack{};
+        int nextIndex = 0;
+        int componentCount = 0;
+
+        auto const visit = [&](int course) {
+            indexes[static_cast<size_t>(course)] = lowlinks[static_cast<size_t>(course)] = nextIndex++;
+            componentStack.push_back(course);
+            stack.push_back({course, courses.offsets[static_cast<size_t>(course)]});
+        };
+
+        for (int root = 0; numCourses > root; ++root) {
+            if (-1 != indexes[static_cast<size_t>(root)]) { continue; }
+
+            visit(root);
+            while (!stack.empty()) {
+                auto& frame = stack.back();
+                auto const course = frame.course;
+                auto& lowlink = lowlinks[static_cast<size_t>(course)];
+                if (courses.offsets[static_cast<size_t>(course) + 1] != frame.nextEdge) {
+                    auto const dependency = courses.targets[static_cast<size_t>(frame.nextEdge++)];
+                    if (-1 == indexes[static_cast<size_t>(dependency)]) {
+                        visit(dependency);
+                    } else if (-1 == componentOf[static_cast<size_t>(dependency)]) {
+                        lowlink = (min)(lowlink, indexes[static_cast<size_t>(dependency)]);
+                    }
+                    continue;
+                }
+
+                // All dependencies visited: retire the course.
+                if (indexes[static_cast<size_t>(course)] == lowlink) {
+                    int member{};
+                    do {
+                        member = componentStack.back();
+                        componentStack.pop_back();
+                        componentOf[static_cast<size_t>(member)] = componentCount;
+                        order.push_back(member);
+                    } while (course != member);
+                    ++componentCount;
+                }
+                auto const retiredLowlink = lowlink;
+                stack.pop_back();
+                if (!stack.empty()) {
+                    auto& parentLowlink = lowlinks[static_cast<size_t>(stack.back().course)];
+                    parentLowlink = (min)(parentLowlink, retiredLowlink);
+                }
+            }
+        }
+
+        return componentCount;
+    }
+};
+
+class Solution6_BitsetReachability {
+    using word_t = uint64_t;
+    static constexpr size_t wordBits = 64;
+
+    int numCourses_{};
+    size_t rowWords_{}; //!< Words per bitset row.
+    vector<word_t> reachable_{}; //!< Row 'c' has bit 'p' set when 'p' is a (transitive) prerequisite of 'c'.
+
+public:
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+
+        Aimed at dense catalogs (E close to V^2), where the per-edge work of
+        the other engines dominates.  Each course owns a packed bitset row of
+        its transitive prerequisites:
+          1) Order the courses prerequisites first with the iterative DFS of
+             Solution3_IterativeDFS; a cycle means the courses can't finish.
+          2) Visit the courses in that order.  For each prerequisite p of
+             course c set bit p in row c and OR row p into row c.  Row p is
+             already complete, so every row is complete when its course is
+             visited.
+        The row OR is a plain loop over 64 bit words, which the compiler
+        vectorizes.  The rows are kept, so after canFinish() returns true
+        isPrerequisite() answers reachability queries in O(1).
+
+        Time = O(V + E * V / 64)
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+
+        Space = O(V^2 / 8) bytes for the rows, plus O(V + E) for the CSR graph.
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        return canFinish(makeCsrGraph(numCourses, prerequisites));
+    }
+
+    bool canFinish(csr_graph_view_t courses) {
+        numCourses_ = 0;
+        reachable_.clear();
+
+        auto const schedule = Solution3_IterativeDFS{}.findOrderOrCycle(courses);
+        if (!schedule.canFinish) { return false; }
+
+        numCourses_ = courses.nodeCount();
+        rowWords_ = (static_cast<size_t>(numCourses_) + wordBits - 1) / wordBits;
+        reachable_.assign(static_cast<size_t>(numCourses_) * rowWords_, 0);
+        for (auto const course : schedule.order) {
+            auto* const row = &reachable_[static_cast<size_t>(course) * rowWords_];
+            for (auto const prerequisite : courses.neighbors(course)) {
+                auto const* const prerequisiteRow = &reachable_[static_cast<size_t>(prerequisite) * rowWords_];
+                for (size_t word = 0; rowWords_ > word; ++word) {
+                    row[word] |= prerequisiteRow[word];
+                }
+                auto const bit = static_cast<size_t>(prerequisite);
+                row[bit / wordBits] |= word_t{1} << (bit % wordBits);
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+        \brief True when 'prerequisite' must be taken (directly or transitively) before 'course'.
+
+        Only valid after canFinish() returned true; it answers from the rows
+        built by that call.
+    */
+    bool isPrerequisite(int prerequisite, int course) const noexcept {
+        assert(0 <= prerequisite && numCourses_ > prerequisite);
+        assert(0 <= course && numCourses_ > course);
+        auto const bit = static_cast<size_t>(prerequisite);
+        auto const word = reachable_[static_cast<size_t>(course) * rowWords_ + bit / wordBits];
+        return 0 != ((word >> (bit % wordBits)) & 1);
+    }
+};
+
+class Solution7_ParallelDFS {
+        //! Shared per-course state.  in progress is only a hint that some worker is searching the course.
+        enum state_t : uint8_t { unvisited = 0, inProgress = 1, done = 2 };
+
+        struct frame_t {
+            int course{}; //!< Course being expanded.
+            int nextEdge{}; //!< Index (in courses.targets) of the next dependency to visit.
+        };
+
+        //! Roots [next, end) of one shared root range; any worker claims roots by advancing 'next'.
+        struct alignas(64) root_range_t {
+            atomic<int> next{};
+            int end{};
+        };
+
+        //! Roots claimed per atomic increment.
+        static constexpr int rootGrain = 64;
+
+        unsigned threadCount_{};
+
+        /*!
+            \brief Depth first search from 'root'; return false if this worker finds a cycle.
+
+            'onPath' marks the courses on this worker's current branch; only
+            those prove a cycle.  A course another worker is still searching
+            is searched again here (it may lead back to this branch), but a
+            course any worker has finished is skipped: it reaches no cycle,
+            so it can't lead back to this branch either.
+        */
+        static bool search(
+            csr_graph_view_t courses
+            , int root
+            , vector<uint8_t>& states
+            , vector<uint8_t>& onPath
+            , vector<frame_t>& stack
+            , atomic<bool> const& cycleFound
+        ) {
+            auto const state = [&](int course) { return atomic_ref<uint8_t>{states[static_cast<size_t>(course)]}; };
+            auto const enter = [&](int course) {
+                auto expected = static_cast<uint8_t>(unvisited);
+                state(course).compare_exchange_strong(expected, inProgress, memory_order_relaxed);
+                onPath[static_cast<size_t>(course)] = true;
+                stack.push_back({course, courses.offsets[static_cast<size_t>(course)]});
+            };
+
+            stack.clear();
+            enter(root);
+            while (!stack.empty()) {
+                if (cycleFound.load(memory_order_relaxed)) { return true; } // Cancelled; the answer is known.
+
+                auto& frame = stack.back();
+                if (courses.offsets[static_cast<size_t>(frame.course) + 1] == frame.nextEdge) {
+                    onPath[static_cast<size_t>(frame.course)] = false;
+                    state(frame.course).store(done, memory_order_release);
+                    stack.pop_back();
+                    continue;
+                }
+
+                auto const dependency = courses.targets[static_cast<size_t>(frame.nextEdge++)];
+                if (onPath[static_cast<size_t>(dependency)]) { return false; }
+                if (done != state(dependency).load(memory_order_acquire)) {
+                    enter(dependency);
+                }
+            }
+
+            return true;
+        }
+
+public:
+    explicit Solution7_ParallelDFS(unsigned threadCount = thread::hardware_concurrency())
+        : threadCount_{(max)(1u, threadCount)} {}
+
+    /*
+        The prerequisites create a dependency tree.
+        Return true only when all branches in the tree contain no cycles.
+
+        Same depth first search as Solution3_IterativeDFS, started from many
+        roots at once, for catalogs made of many deep but independent parts
+        where Solution4_ParallelTopologicalSort finds little width:
+          1) The courses are split into shared root ranges, one contiguous
+             range per worker.  A worker claims chunks of roots from its own
+             range through the range's atomic cursor and, once that range is
+             exhausted, claims from the other ranges' cursors the same way.
+             There are no per-worker deques, and two workers can still
+             search the same course (see 2).
+          2) Each course has a shared atomic state: unvisited, in progress
+             (some worker is searching it), or done.  A worker starts only
+             from unvisited roots and skips done courses inside its search,
+             so finished subgraphs are shared between workers, like the
+             finished flags of Solution1_DFS.
+          3) Each worker keeps its own on-path marks.  Reaching a course on
+             its own path is a cycle: the worker raises a shared flag, and
+             every worker stops at its next step.
+
+        Time = O((V + E) / T) when the parts are independent; courses that
+               two workers reach at the same time are searched by both.
+               V = vertex count == numCourses
+               E = edge count == len(prerequisites)
+               T = thread count
+
+        Space = O(T * V + E)
+                T * V = per worker on-path marks and stacks.
+                E = CSR edge targets.
+    */
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        return canFinish(makeCsrGraphParallel(numCourses, prerequisites, threadCount_));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        return canFinish(makeCsrGraphParallel(numCourses, prerequisites, threadCount_));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        return canFinish(makeCsrGraphParallel(numCourses, prerequisites, threadCount_));
+    }
+
+    bool canFinish(csr_graph_view_t courses) {
+        auto const numCourses = courses.nodeCount();
+        auto const workerCount = static_cast<unsigned>(
+            (min)(static_cast<int>(threadCount_), (max)(1, numCourses / rootGrain))
+        );
+
+        vector<uint8_t> states(static_cast<size_t>(numCourses), unvisited);
+        vector<root_range_t> ranges(workerCount);
+        for (unsigned workerIdx = 0; workerCount > workerIdx; ++workerIdx) {
+            auto const begin = static_cast<int>(static_cast<int64_t>(numCourses) * workerIdx / workerCount);
+            ranges[workerIdx].next.store(begin, memory_order_relaxed);
+            ranges[workerIdx].end = static_cast<int>(static_cast<int64_t>(numCourses) * (workerIdx + 1) / workerCount);
+        }
+        atomic<bool> cycleFound{false};
+
+        auto const worker = [&](unsigned workerIdx) {
+            vector<uint8_t> onPath(static_cast<size_t>(numCourses), false);
+            vector<frame_t> stack{};
+            for (unsigned rangeOffset = 0; workerCount > rangeOffset; ++rangeOffset) {
+                auto& range = ranges[(workerIdx + rangeOffset) % workerCount];
+                for (auto begin = range.next.fetch_add(rootGrain, memory_order_relaxed);
+                    range.end > begin;
+                    begin = range.next.fetch_add(rootGrain, memory_order_relaxed)
+                ) {
+                    for (auto root = begin; (min)(range.end, begin + rootGrain) > root; ++root) {
+                        if (cycleFound.load(memory_order_relaxed)) { return; }
+                        atomic_ref<uint8_t> rootState{states[static_cast<size_t>(root)]};
+                        if (unvisited != rootState.load(memory_order_relaxed)) { continue; }
+                        if (!search(courses, root, states, onPath, stack, cycleFound)) {
+                            cycleFound.store(true, memory_order_relaxed);
+                            return;
+                        }
+                    }
+                }
+            }
+        };
+
+        {
+            vector<jthread> threads{};
+            threads.reserve(workerCount - 1);
+            for (unsigned workerIdx = 1; workerCount > workerIdx; ++workerIdx) {
+                threads.emplace_back(worker, workerIdx);
+            }
+            worker(0);
+        } // Join.
+
+        return !cycleFound.load(memory_order_relaxed);
+    }
+};
+
+/*!
+    \brief Run precheckCatalog() and hand only the residual graph to 'Engine'.
+
+    Any engine with canFinish(csr_graph_view_t) can be wrapped, e.g.
+    Prechecked<Solution2_TopologicalSort>.  Catalogs with a self-loop or a
+    reversed pair are rejected without building a graph, and the engine
+    never sees courses that trimming proved can't be on a cycle.  stats()
+    reports how much work the pre-pass avoided in the last call.
+
+    The hashed edge set is random access, so on catalogs without trivial
+    defects the pre-pass costs several times the engine itself; wrap an
+    engine only where self-loops and reversed pairs are common.
+
+    Time = O(V + E) plus the engine on the residual graph.
+    Space = O(V + E)
+*/
+template <typename Engine>
+class Prechecked {
+    Engine engine_{};
+    precheck_stats_t stats_{};
+
+    bool decide(precheck_t const& precheck) {
+        stats_ = precheck.stats;
+        switch (precheck.verdict) {
+        case precheck_t::verdict_t::cycle: return false;
+        case precheck_t::verdict_t::acyclic: return true;
+        case precheck_t::verdict_t::undecided: break;
+        }
+        return engine_.canFinish(static_cast<csr_graph_view_t>(precheck.residual));
+    }
+
+public:
+    Prechecked() = default;
+
+    explicit Prechecked(Engine engine) : engine_{std::move(engine)} {}
+
+    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
+        return decide(precheckCatalog(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+    bool canFinish(int numCourses, span<pair<int, int> const> prerequisites) {
+        return decide(precheckCatalog(numCourses, prerequisites));
+    }
+
+    //! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+    bool canFinish(int numCourses, span<int const> prerequisites) {
+        return decide(precheckCatalog(numCourses, prerequisites));
+    }
+
+    precheck_stats_t const& stats() const noexcept { return stats_; }
+};
+
+/*!
+    \brief Online course schedule that rejects a prerequisite the moment it would create a cycle.
+
+    Maintains a topological order of the courses (Pearce & Kelly, "A Dynamic
+    Topological Sort Algorithm for Directed Acyclic Graphs", 2006) instead of
+    re-running canFinish() over every prerequisite after each edit.
+
+    addPrerequisite(ai, bi) takes the same pair as prerequisites[i] = [ai, bi]:
+    course bi must be taken before course ai.  When bi is already ordered
+    before ai nothing moves.  Otherwise only the courses positioned between
+    ai and bi (the affected region) are searched and reordered:
+      1) Search forward (towards dependent courses) from ai, visiting only
+         courses positioned at or before bi.  Reaching bi means bi already
+         depends on ai, so the new prerequisite would close a cycle and is
+         rejected without changing anything.
+      2) Search backward (towards prerequisites) from bi, visiting only
+         courses positioned at or after ai.
+      3) Reassign the positions held by both sets so every backward course
+         precedes every forward course, keeping the relative order in each.
+
+    Time = O(|R| log |R| + edges of R) per insert
+           R = courses in the affected region (none when already ordered).
+
+    Space = O(V + E)
+            V = vertex count == numCourses
+            E = accepted prerequisite count
+*/
+class IncrementalCourseSchedule {
+    vector<vector<int>> prerequisites_{}; //!< course -> its prerequisites.
+    vector<vector<int>> dependents_{}; //!< course -> courses that require it.
+    vector<int> positions_{}; //!< course -> position in order_.
+    vector<int> order_{}; //!< position -> course; prerequisites first.
+    vector<uint8_t> visited_{};
+
+    // Scratch buffers reused by every insert.
+    vector<int> forward_{};
+    vector<int> backward_{};
+    vector<int> stack_{};
+    vector<int> freedPositions_{};
+
+    /*!
+        \brief Collect the courses reachable from 'start' through 'edges' within positions [lowerBound, upperBound].
+
+        Returns false (and stops early) if 'stop' is reached.
+    */
+    bool collect(
+        int start
+        , vector<vector<int>> const& edges
+        , int lowerBound
+        , int upperBound
+        , int stop
+        , vector<int>& region
+    ) {
+        region.clear();
+        stack_.assign(1, start);
+        visited_[static_cast<size_t>(start)] = true;
+        while (!stack_.empty()) {
+            auto const course = stack_.back();
+            stack_.pop_back();
+            region.push_back(course);
+
+            for (auto const next : edges[static_cast<size_t>(course)]) {
+                if (stop == next) { return false; }
+
+                auto const position = positions_[static_cast<size_t>(next)];
+                auto& visited = visited_[static_cast<size_t>(next)];
+                if (!visited && lowerBound <= position && upperBound >= position) {
+                    visited = true;
+                    stack_.push_back(next);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void clearVisited(span<int const> courses) noexcept {
+        for (auto const course : courses) {
+            visited_[static_cast<size_t>(course)] = false;
+        }
+    }
+
+public:
+    explicit IncrementalCourseSchedule(int numCourses)
+        : prerequisites_(static_cast<size_t>(numCourses))
+        , dependents_(static_cast<size_t>(numCourses))
+        , positions_(static_cast<size_t>(numCourses))
+        , order_(static_cast<size_t>(numCourses))
+        , visited_(static_cast<size_t>(numCourses), false)
+    {
+        iota(positions_.begin(), positions_.end(), 0);
+        iota(order_.begin(), order_.end(), 0);
+    }
+
+    int courseCount() const noexcept { return static_cast<int>(order_.size()); }
+
+    //! Every course, each after all of its accepted prerequisites.
+    span<int const> order() const noexcept { return order_; }
+
+    /*!
+        \brief Require 'prerequisite' to be taken before 'course'.
+
+        Returns false, leaving the schedule unchanged, when that would create
+        a cyclic dependency.
+    */
+    bool addPrerequisite(int course, int prerequisite) {
+        assert(0 <= course && courseCount() > course);
+        assert(0 <= prerequisite && courseCount() > prerequisite);
+
+        if (course == prerequisite) { return false; }
+
+        auto const lowerBound = positions_[static_cast<size_t>(course)];
+        auto const upperBound = positions_[static_cast<size_t>(prerequisite)];
+        if (lowerBound > upperBound) {
+            // Already ordered: the prerequisite precedes the course.
+            prerequisites_[static_cast<size_t>(course)].push_back(prerequisite);
+            dependents_[static_cast<size_t>(prerequisite)].push_back(course);
+            return true;
+        }
+
+        // Courses that (transitively) require 'course' and sit at or before 'prerequisite'.
+        if (!collect(course, dependents_, lowerBound, upperBound, prerequisite, forward_)) {
+            clearVisited(forward_);
+            clearVisited(stack_);
+            return false;
+        }
+
+        // Courses that 'prerequisite' (transitively) requires and sit at or after 'course'.
+        collect(prerequisite, prerequisites_, lowerBound, upperBound, -1, backward_);
+
+        // Reuse the positions of both sets: backward courses first, then forward courses.
+        auto const byPosition = [&](int lhs, int rhs) {
+            return positions_[static_cast<size_t>(lhs)] < positions_[static_cast<size_t>(rhs)];
+        };
+        sort(forward_.begin(), forward_.end(), byPosition);
+        sort(backward_.begin(), backward_.end(), byPosition);
+
+        freedPositions_.clear();
+        for (auto const moved : {span<int const>{backward_}, span<int const>{forward_}}) {
+            for (auto const movedCourse : moved) {
+                freedPositions_.push_back(positions_[static_cast<size_t>(movedCourse)]);
+            }
+        }
+        sort(freedPositions_.begin(), freedPositions_.end());
+
+        auto freedPosition = freedPositions_.begin();
+        for (auto const moved : {span<int const>{backward_}, span<int const>{forward_}}) {
+            for (auto const movedCourse : moved) {
+                positions_[static_cast<size_t>(movedCourse)] = *freedPosition;
+                order_[static_cast<size_t>(*freedPosition)] = movedCourse;
+                ++freedPosition;
+            }
+        }
+
+        clearVisited(forward_);
+        clearVisited(backward_);
+
+        prerequisites_[static_cast<size_t>(course)].push_back(prerequisite);
+        dependents_[static_cast<size_t>(prerequisite)].push_back(course);
+        return true;
+    }
+};
+
+/*!
+    \brief Answer many "base catalog + extra prerequisites" canFinish() queries against one shared base catalog.
+
+    The base catalog is preprocessed once with Solution5_TarjanSCC: either it
+    already contains a cycle (then every query is false), or its components
+    are single courses whose ids are a topological order (positions) in which
+    every base prerequisite is positioned before the course requiring it.
+
+    A query adds overlay prerequisites [ai, bi] on top of the base.  An
+    overlay prerequisite with bi positioned before ai agrees with the base
+    order and can not close a cycle on its own.  Every cycle must therefore
+    use at least one "backward" overlay prerequisite (bi positioned at or
+    after ai), and the courses of such a cycle all lie between the lowest
+    positioned backward course ai and the highest positioned backward
+    prerequisite bi.  So each query:
+      1) Returns true immediately when no overlay prerequisite is backward.
+      2) Otherwise runs an iterative three color DFS over base + overlay
+         edges, starting from the backward prerequisites and visiting only
+         courses positioned inside that window.
+    Scratch arrays are per worker and stamped with a query epoch, so they are
+    never cleared between queries.  canFinish(queries) hands queries to a
+    small pool of threads through an atomic work index.
+
+    Thread safety: canFinish(query_t) is const and uses its own scratch, so
+    any number of threads may call it on one shared object.  The batch
+    canFinish(queries) reuses the object's workers across calls, so it must
+    not run concurrently with another batch call on the same object.
+
+    Time = O(V + E) once, then O(D + edges in the window) per query
+           V = vertex count == numCourses
+           E = base prerequisite count
+           D = overlay prerequisite count of the query
+
+    Space = O(V + E) shared, O(V + D) per worker
+*/
+class BatchCourseSchedule {
+public:
+    using query_t = span<pair<int, int> const>; //!< Overlay prerequisites [(ai, bi), ...].
+
+    BatchCourseSchedule(
+        int numCourses
+        , span<pair<int, int> const> prerequisites
+        , unsigned threadCount = thread::hardware_concurrency()
+    )
+        : BatchCourseSchedule{makeCsrGraph(numCourses, prerequisites), threadCount} {}
+
+    BatchCourseSchedule(
+        int numCourses
+        , vector<vector<int>> const& prerequisites
+        , unsigned threadCount = thread::hardware_concurrency()
+    )
+        : BatchCourseSchedule{makeCsrGraph(numCourses, prerequisites), threadCount} {}
+
+    explicit BatchCourseSchedule(csr_graph_t base, unsigned threadCount = thread::hardware_concurrency())
+        : base_{std::move(base)}
+        , threadCount_{(max)(1u, threadCount)}
+    {
+        auto components = Solution5_TarjanSCC{}.diagnose(base_);
+        baseCanFinish_ = components.cyclicComponents.empty();
+        positions_ = std::move(components.componentOf);
+    }
+
+    int courseCount() const noexcept { return base_.nodeCount(); }
+
+    //! True when the base catalog alone can be finished.
+    bool baseCanFinish() const noexcept { return baseCanFinish_; }
+
+    //! Answer one query on the calling thread, with scratch local to the call (allocated only if it needs a DFS).
+    bool canFinish(query_t overlay) const {
+        worker_t worker{};
+        return canFinish(overlay, worker);
+    }
+
+    //! Answer every query; result[i] is the answer to queries[i].
+    vector<bool> canFinish(span<vector<pair<int, int>> const> queries) {
+        vector<uint8_t> answers(queries.size(), false);
+        if (baseCanFinish_ && !queries.empty()) {
+            auto const threadCount = static_cast<unsigned>((min)(static_cast<size_t>(threadCount_), queries.size()));
+            if (workers_.size() < threadCount) { workers_.resize(threadCount); }
+
+            atomic<size_t> nextQuery{0};
+            auto const work = [&](unsigned workerIdx) {
+                auto& worker = workers_[workerIdx];
+                for (auto queryIdx = nextQuery.fetch_add(1, memory_order_relaxed);
+                    queries.size() > queryIdx;
+                    queryIdx = nextQuery.fetch_add(1, memory_order_relaxed)
+                ) {
+                    answers[queryIdx] = canFinish(queries[queryIdx], worker);
+                }
+            };
+
+            vector<jthread> threads{};
+            threads.reserve(threadCount - 1);
+            for (unsigned workerIdx = 1; threadCount > workerIdx; ++workerIdx) {
+                threads.emplace_back(work, workerIdx);
+            }
+            work(0);
+        }
+
+        return vector<bool>(answers.begin(), answers.end());
+    }
+
+private:
+    enum class color : uint8_t { gray, black };
+
+    struct frame_t {
+        int course{}; //!< Course being expanded.
+        int nextEdge{}; //!< Index (in base_.targets) of the next base prerequisite to visit.
+        int nextOverlay{}; //!< Next overlay prerequisite (index into the query) to visit; -1 when done.
+    };
+
+    //! Per thread scratch; an entry is valid only when its stamp equals the current epoch.
+    struct worker_t {
+        uint32_t epoch{};
+        vector<uint32_t> visitStamps{};
+        vector<color> colors{};
+        vector<uint32_t> overlayStamps{};
+        vector<int> overlayHeads{}; //!< course -> first overlay prerequisite of the course.
+        vector<int> overlayNext{}; //!< overlay prerequisite -> next overlay prerequisite of the same course.
+        vector<frame_t> stack{};
+    };
+
+    csr_graph_t base_{};
+    vector<int> positions_{}; //!< course -> position in a topological order of the base.
+    bool baseCanFinish_{};
+    unsigned threadCount_{};
+    vector<worker_t> workers_{};
+
+    bool canFinish(query_t overlay, worker_t& worker) const {
+        if (!baseCanFinish_) { return false; }
+
+        // Window spanned by the backward overlay prerequisites.
+        auto lowerBound = (numeric_limits<int>::max)();
+        auto upperBound = (numeric_limits<int>::min)();
+        for (auto const& [course, prerequisite] : overlay) {
+            assert(0 <= course && courseCount() > course);
+            assert(0 <= prerequisite && courseCount() > prerequisite);
+            auto const coursePosition = positions_[static_cast<size_t>(course)];
+            auto const prerequisitePosition = positions_[static_cast<size_t>(prerequisite)];
+            if (coursePosition <= prerequisitePosition) {
+                if (course == prerequisite) { return false; }
+                lowerBound = (min)(lowerBound, coursePosition);
+                upperBound = (max)(upperBound, prerequisitePosition);
+            }
+        }
+        if (lowerBound > upperBound) { return true; }
+
+        // Start a new epoch, lazily sizing the scratch arrays and resetting them on wrap around.
+        auto const numCourses = static_cast<size_t>(courseCount());
+        if (worker.visitStamps.size() != numCourses || 0 == ++worker.epoch) {
+            worker.visitStamps.assign(numCourses, 0);
+            worker.colors.assign(numCourses, color::gray);
+            worker.overlayStamps.assign(numCourses, 0);
+            worker.overlayHeads.assign(numCourses, -1);
+            worker.epoch = 1;
+        }
+        auto const epoch = worker.epoch;
+
+        // Thread the overlay prerequisites into per course lists.
+        worker.overlayNext.resize(overlay.size());
+        for (size_t overlayIdx = 0; overlay.size() > overlayIdx; ++overlayIdx) {
+            auto const course = static_cast<size_t>(overlay[overlayIdx].first);
+            auto& head = worker.overlayHeads[course];
+            if (epoch != worker.overlayStamps[course]) {
+                worker.overlayStamps[course] = epoch;
+                head = -1;
+            }
+            worker.overlayNext[overlayIdx] = head;
+            head = static_cast<int>(overlayIdx);
+        }
+        auto const firstOverlay = [&](int course) {
+            return epoch == worker.overlayStamps[static_cast<size_t>(course)]
+                ? worker.overlayHeads[static_cast<size_t>(course)]
+                : -1;
+        };
+
+        // Returns false when 'course' closes a cycle (it is gray on the current path).
+        auto& stack = worker.stack;
+        auto const visit = [&](int course) {
+            auto const position = positions_[static_cast<size_t>(course)];
+            if (lowerBound > position || upperBound < position) { return true; }
+
+            auto& stamp = worker.visitStamps[static_cast<size_t>(course)];
+            if (epoch == stamp) { return color::gray != worker.colors[static_cast<size_t>(course)]; }
+
+            stamp = epoch;
+            worker.colors[static_cast<size_t>(course)] = color::gray;
+            stack.push_back({course, base_.offsets[static_cast<size_t>(course)], firstOverlay(course)});
+            return true;
+        };
+
+        for (auto const& [course, prerequisite] : overlay) {
+            if (positions_[static_cast<size_t>(course)] > positions_[static_cast<size_t>(prerequisite)]) { continue; }
+
+            stack.clear();
+            if (!visit(prerequisite)) { return false; }
+            while (!stack.empty()) {
+                auto& frame = stack.back();
+                int next{};
+                if (base_.offsets[static_cast<size_t>(frame.course) + 1] != frame.nextEdge) {
+                    next = base_.targets[static_cast<size_t>(frame.nextEdge++)];
+                } else if (-1 != frame.nextOverlay) {
+                    next = overlay[static_cast<size_t>(frame.nextOverlay)].second;
+                    frame.nextOverlay = worker.overlayNext[static_cast<size_t>(frame.nextOverlay)];
+                } else {
+                    worker.colors[static_cast<size_t>(frame.course)] = color::black;
+                    stack.pop_back();
+                    continue;
+                }
+                if (!visit(next)) { return false; }
+            }
+        }
+
+        return true;
+    }
+};
+
+#endif // #ifndef COURSE_SCHEDULE_HPP_BD4C5751_6CD7_4ADA_A8D6_689B6B6CFBDD
+
+/*
+    End of "course_schedule.hpp"
+*/
@@ -0,0 +1,279 @@
+/*!
+    \file "csr_graph.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Compressed sparse row (CSR) directed graph shared by the course schedule engines.
+*/
+
+#include "csr_graph.hpp"
+
+#include <algorithm>
+#include <barrier>
+#include <numeric>
+#include <thread>
+
+namespace {
+
+//! Fewer edges than this per thread are not worth a thread.
+constexpr std::size_t parallelBuildGrain = std::size_t{1} << 16;
+
+/*!
+    \brief Size the graph's buffers and run scatterCsrRows() for one edge layout.
+
+    'sourceOf(idx)' and 'targetOf(idx)' return the endpoints of edge 'idx'.
+*/
+template <typename SourceOf, typename TargetOf>
+void
+buildCsrGraph(csr_graph_t& graph, int nodeCount, size_t edgeCount, SourceOf sourceOf, TargetOf targetOf) {
+    assert(0 <= nodeCount);
+
+    graph.offsets.assign(static_cast<size_t>(nodeCount) + 2, 0);
+    graph.targets.resize(edgeCount);
+    scatterCsrRows(graph.offsets, graph.targets, nodeCount, edgeCount, sourceOf, targetOf);
+    graph.offsets.pop_back();
+}
+
+/*!
+    \brief Parallel version of buildCsrGraph(); the graph is identical, including the order within each row.
+
+    Edge range 't' (the edges are split into 'threadCount' contiguous ranges)
+    is handled by thread 't' in four phases separated by a barrier:
+      1) Count the out-degree of each node over the thread's edges into its
+         own histogram row (no sharing, no atomics).
+      2) Sum the histograms over the thread's slice of nodes.
+      3) Once the slice sums are prefix summed, walk the node slice again:
+         write the row offsets and turn each histogram entry into the cursor
+         at which that thread writes its first edge of the row.  Threads get
+         consecutive cursors in thread order, so rows keep edge order.
+      4) Scatter the thread's edges through its cursors.
+*/
+template <typename SourceOf, typename TargetOf>
+void
+buildCsrGraphParallel(
+    csr_graph_t& graph
+    , int nodeCount
+    , std::size_t edgeCount
+    , unsigned threadCount
+    , SourceOf sourceOf
+    , TargetOf targetOf
+) {
+    assert(0 <= nodeCount);
+    auto const nodes = static_cast<std::size_t>(nodeCount);
+    auto const threads = static_cast<std::size_t>(
+        std::clamp<std::size_t>(edgeCount / parallelBuildGrain, 1, (std::max)(1u, threadCount))
+    );
+    if (1 == threads) {
+        buildCsrGraph(graph, nodeCount, edgeCount, sourceOf, targetOf);
+        return;
+    }
+
+    graph.offsets.resize(nodes + 1);
+    graph.targets.resize(edgeCount);
+    std::vector<int> histograms(threads * nodes);
+    std::vector<std::size_t> sliceSums(threads + 1, 0);
+
+    auto const prefixSliceSums = [&]() noexcept {
+        std::partial_sum(sliceSums.begin(), sliceSums.end(), sliceSums.begin());
+    };
+    std::barrier phaseBarrier{static_cast<std::ptrdiff_t>(threads), prefixSliceSums};
+
+    auto const build = [&](std::size_t threadIdx) {
+        auto const edgeBegin = edgeCount * threadIdx / threads;
+        auto const edgeEnd = edgeCount * (threadIdx + 1) / threads;
+        auto const nodeBegin = nodes * threadIdx / threads;
+        auto const nodeEnd = nodes * (threadIdx + 1) / threads;
+        auto* const histogram = &histograms[threadIdx * nodes];
+
+        // 1) Per thread out-degrees.
+        for (auto edgeIdx = edgeBegin; edgeEnd > edgeIdx; ++edgeIdx) {
+            auto const source = sourceOf(edgeIdx);
+            assert(0 <= source && nodeCount > source);
+            ++histogram[static_cast<std::size_t>(source)];
+        }
+        phaseBarrier.arrive_and_wait();
+
+        // 2) Edges in this node slice; sliceSums[0] stays zero for the prefix sum.
+        std::size_t sliceSum = 0;
+        for (auto node = nodeBegin; nodeEnd > node; ++node) {
+            for (std::size_t countIdx = node; histograms.size() > countIdx; countIdx += nodes) {
+                sliceSum += static_cast<std::size_t>(histograms[countIdx]);
+            }
+        }
+        sliceSums[threadIdx + 1] = sliceSum;
+        phaseBarrier.arrive_and_wait();
+
+        // 3) Row offsets and per thread cursors.
+        auto cursor = static_cast<int>(sliceSums[threadIdx]);
+        for (auto node = nodeBegin; nodeEnd > node; ++node) {
+            graph.offsets[node] = cursor;
+            for (std::size_t countIdx = node; histograms.size() > countIdx; countIdx += nodes) {
+                auto const count = histograms[countIdx];
+                histograms[countIdx] = cursor;
+                cursor += count;
+            }
+        }
+        phaseBarrier.arrive_and_wait();
+
+        // 4) Scatter.
+        for (auto edgeIdx = edgeBegin; edgeEnd > edgeIdx; ++edgeIdx) {
+            auto& edgeCursor = histogram[static_cast<std::size_t>(sourceOf(edgeIdx))];
+            graph.targets[static_cast<std::size_t>(edgeCursor++)] = targetOf(edgeIdx);
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers{};
+        workers.reserve(threads - 1);
+        for (std::size_t threadIdx = 1; threads > threadIdx; ++threadIdx) {
+            workers.emplace_back(build, threadIdx);
+        }
+        build(0);
+    }
+    graph.offsets[nodes] = static_cast<int>(edgeCount);
+}
+
+} // namespace {
+
+void
+assignCsrGraph(csr_graph_t& graph, int nodeCount, std::vector<std::vector<int>> const& edges) {
+    buildCsrGraph(
+        graph
+        , nodeCount
+        , edges.size()
+        , [&](size_t idx) { return edges[idx][0]; }
+        , [&](size_t idx) { return edges[idx][1]; }
+    );
+}
+
+void
+assignCsrGraph(csr_graph_t& graph, int nodeCount, std::span<std::pair<int, int> const> edges) {
+    buildCsrGraph(
+        graph
+        , nodeCount
+        , edges.size()
+        , [&](size_t idx) { return edges[idx].first; }
+        , [&](size_t idx) { return edges[idx].second; }
+    );
+}
+
+void
+assignCsrGraph(csr_graph_t& graph, int nodeCount, std::span<int const> edges) {
+    assert(0 == edges.size() % 2);
+    buildCsrGraph(
+        graph
+        , nodeCount
+        , edges.size() / 2
+        , [&](size_t idx) { return edges[2 * idx]; }
+        , [&](size_t idx) { return edges[2 * idx + 1]; }
+    );
+}
+
+void
+assignReversedCsrGraph(csr_graph_t& reversed, csr_graph_view_t graph) {
+    auto const nodeCount = static_cast<size_t>(graph.nodeCount());
+
+    // Count in-degrees two slots to the right, exactly like scatterCsrRows().
+    reversed.offsets.assign(nodeCount + 2, 0);
+    for (auto const target : graph.targets) {
+        ++reversed.offsets[static_cast<size_t>(target) + 2];
+    }
+    for (size_t idx = 2; reversed.offsets.size() > idx; ++idx) {
+        reversed.offsets[idx] += reversed.offsets[idx - 1];
+    }
+
+    reversed.targets.resize(graph.targets.size());
+    for (size_t source = 0; nodeCount > source; ++source) {
+        for (auto const target : graph.neighbors(static_cast<int>(source))) {
+            auto& cursor = reversed.offsets[static_cast<size_t>(target) + 1];
+            reversed.targets[static_cast<size_t>(cursor++)] = static_cast<int>(source);
+        }
+    }
+
+    reversed.offsets.pop_back();
+}
+
+csr_graph_t
+makeCsrGraph(int nodeCount, std::vector<std::vector<int>> const& edges, std::pmr::memory_resource* resource) {
+    csr_graph_t graph{resource};
+    assignCsrGraph(graph, nodeCount, edges);
+    return graph;
+}
+
+csr_graph_t
+makeCsrGraph(int nodeCount, std::span<std::pair<int, int> const> edges, std::pmr::memory_resource* resource) {
+    csr_graph_t graph{resource};
+    assignCsrGraph(graph, nodeCount, edges);
+    return graph;
+}
+
+csr_graph_t
+makeCsrGraph(int nodeCount, std::span<int const> edges, std::pmr::memory_resource* resource) {
+    csr_graph_t graph{resource};
+    assignCsrGraph(graph, nodeCount, edges);
+    return graph;
+}
+
+csr_graph_t
+makeCsrGraphParallel(
+    int nodeCount
+    , std::vector<std::vector<int>> const& edges
+    , unsigned threadCount
+    , std::pmr::memory_resource* resource
+) {
+    csr_graph_t graph{resource};
+    buildCsrGraphParallel(
+        graph
+        , nodeCount
+        , edges.size()
+        , threadCount
+        , [&](size_t idx) { return edges[idx][0]; }
+        , [&](size_t idx) { return edges[idx][1]; }
+    );
+    return graph;
+}
+
+csr_graph_t
+makeCsrGraphParallel(
+    int nodeCount
+    , std::span<std::pair<int, int> const> edges
+    , unsigned threadCount
+    , std::pmr::memory_resource* resource
+) {
+    csr_graph_t graph{resource};
+    buildCsrGraphParallel(
+        graph
+        , nodeCount
+        , edges.size()
+        , threadCount
+        , [&](size_t idx) { return edges[idx].first; }
+        , [&](size_t idx) { return edges[idx].second; }
+    );
+    return graph;
+}
+
+csr_graph_t
+makeCsrGraphParallel(
+    int nodeCount
+    , std::span<int const> edges
+    , unsigned threadCount
+    , std::pmr::memory_resource* resource
+) {
+    assert(0 == edges.size() % 2);
+    csr_graph_t graph{resource};
+    buildCsrGraphParallel(
+        graph
+        , nodeCount
+        , edges.size() / 2
+        , threadCount
+        , [&](size_t idx) { return edges[2 * idx]; }
+        , [&](size_t idx) { return edges[2 * idx + 1]; }
+    );
+    return graph;
+}
+
+/*
+    End of "csr_graph.cpp"
+*/
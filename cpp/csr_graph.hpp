@@ -0,0 +1,265 @@
+/*!
+    \file "csr_graph.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Compressed sparse row (CSR) directed graph shared by the course schedule engines.
+*/
+
+#ifndef CSR_GRAPH_HPP_E5610060_D188_4BC4_BD1C_B9A05A376D75
+#define CSR_GRAPH_HPP_E5610060_D188_4BC4_BD1C_B9A05A376D75
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+/*!
+    \brief Non-owning view of a CSR graph.
+
+    The engines consume this view, so the rows may live in a csr_graph_t or
+    directly in externally owned memory, e.g. a memory mapped file.
+*/
+struct csr_graph_view_t
+{
+    std::span<int const> offsets{}; //!< nodeCount() + 1 entries; offsets[0] == 0.
+    std::span<int const> targets{}; //!< edgeCount() entries grouped by source node.
+
+    constexpr int nodeCount() const noexcept {
+        return offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+    }
+
+    constexpr int edgeCount() const noexcept { return static_cast<int>(targets.size()); }
+
+    constexpr std::span<int const> neighbors(int node) const noexcept {
+        assert(0 <= node && nodeCount() > node);
+        auto const begin = static_cast<size_t>(offsets[static_cast<size_t>(node)]);
+        auto const end = static_cast<size_t>(offsets[static_cast<size_t>(node) + 1]);
+        return targets.subspan(begin, end - begin);
+    }
+};
+
+/*!
+    \brief Directed graph stored as compressed sparse rows.
+
+    The out-edges of node 'n' are targets[offsets[n]] .. targets[offsets[n + 1] - 1].
+    The whole graph lives in two flat arrays, so it costs exactly two heap
+    allocations to build and visiting the neighbors of a node is a linear scan
+    of contiguous memory.
+
+    Edges built from prerequisites point from a course to its prerequisite, i.e.
+    prerequisites[i] = [ai, bi] becomes the edge ai -> bi.
+
+    Both arrays draw from a std::pmr memory resource, so a call can build its
+    graph in a per-call arena and release it all at once.
+*/
+struct csr_graph_t
+{
+    std::pmr::vector<int> offsets{}; //!< nodeCount() + 1 entries; offsets[0] == 0.
+    std::pmr::vector<int> targets{}; //!< edgeCount() entries grouped by source node.
+
+    csr_graph_t() = default;
+
+    explicit csr_graph_t(std::pmr::memory_resource* resource) : offsets{resource}, targets{resource} {}
+
+    int nodeCount() const noexcept {
+        return offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+    }
+
+    int edgeCount() const noexcept { return static_cast<int>(targets.size()); }
+
+    std::span<int const> neighbors(int node) const noexcept {
+        assert(0 <= node && nodeCount() > node);
+        auto const begin = static_cast<size_t>(offsets[static_cast<size_t>(node)]);
+        auto const end = static_cast<size_t>(offsets[static_cast<size_t>(node) + 1]);
+        return std::span<int const>{targets}.subspan(begin, end - begin);
+    }
+
+    operator csr_graph_view_t() const noexcept { return {offsets, targets}; }
+};
+
+/*!
+    \brief Two pass count/scatter CSR construction shared by every builder.
+
+    'offsets' must hold nodeCount + 2 zeroed entries and 'targets' edgeCount
+    entries.  On return offsets[0 .. nodeCount] are the row offsets (the last
+    entry is scratch).  'sourceOf(idx)' and 'targetOf(idx)' return the
+    endpoints of edge 'idx'.
+*/
+template <typename SourceOf, typename TargetOf>
+constexpr void
+scatterCsrRows(
+    std::span<int> offsets
+    , std::span<int> targets
+    , [[maybe_unused]] int nodeCount
+    , std::size_t edgeCount
+    , SourceOf sourceOf
+    , TargetOf targetOf
+) {
+    assert(static_cast<std::size_t>(nodeCount) + 2 == offsets.size());
+    assert(edgeCount == targets.size());
+
+    // Count the out-degree of each node two slots to the right of its row so
+    // that, after the prefix sum, offsets[node + 1] is the start of the row
+    // and can be used directly as the scatter cursor.
+    for (std::size_t edgeIdx = 0; edgeCount > edgeIdx; ++edgeIdx) {
+        auto const source = sourceOf(edgeIdx);
+        assert(0 <= source && nodeCount > source);
+        ++offsets[static_cast<std::size_t>(source) + 2];
+    }
+    for (std::size_t idx = 2; offsets.size() > idx; ++idx) {
+        offsets[idx] += offsets[idx - 1];
+    }
+
+    // Scatter the targets; each cursor ends up at the start of the next row.
+    for (std::size_t edgeIdx = 0; edgeCount > edgeIdx; ++edgeIdx) {
+        auto& cursor = offsets[static_cast<std::size_t>(sourceOf(edgeIdx)) + 1];
+        targets[static_cast<std::size_t>(cursor++)] = targetOf(edgeIdx);
+    }
+}
+
+/*!
+    \brief CSR graph with sizes fixed at compile time, usable in constant expressions.
+
+    offsets holds one scratch entry past the row offsets (see scatterCsrRows()).
+*/
+template <std::size_t NodeCount, std::size_t EdgeCount>
+struct static_csr_graph_t
+{
+    std::array<int, NodeCount + 2> offsets{};
+    std::array<int, EdgeCount> targets{};
+
+    constexpr operator csr_graph_view_t() const noexcept {
+        return {std::span<int const>{offsets}.first(NodeCount + 1), targets};
+    }
+};
+
+//! Build a static_csr_graph_t from [source, target] pairs in a constant expression.
+template <std::size_t NodeCount, std::size_t EdgeCount>
+constexpr static_csr_graph_t<NodeCount, EdgeCount>
+makeStaticCsrGraph(std::array<std::pair<int, int>, EdgeCount> const& edges) {
+    static_csr_graph_t<NodeCount, EdgeCount> graph{};
+    scatterCsrRows(
+        graph.offsets
+        , graph.targets
+        , static_cast<int>(NodeCount)
+        , EdgeCount
+        , [&](std::size_t idx) { return edges[idx].first; }
+        , [&](std::size_t idx) { return edges[idx].second; }
+    );
+    return graph;
+}
+
+/*!
+    \brief Build a CSR graph from leetcode style edges ([source, target] pairs).
+
+    Two passes over 'edges': the first counts the out-degree of each node, the
+    second scatters each target into its source node's row.  Rows keep the
+    order in which their edges appear in 'edges'.  The rows are allocated
+    from 'resource'.
+*/
+csr_graph_t
+makeCsrGraph(
+    int nodeCount
+    , std::vector<std::vector<int>> const& edges
+    , std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+/*!
+    \brief Build a CSR graph from a flat buffer of (source, target) pairs.
+
+    The buffer is only read, never copied, so it may point into a memory
+    mapped file or a column store.
+*/
+csr_graph_t
+makeCsrGraph(
+    int nodeCount
+    , std::span<std::pair<int, int> const> edges
+    , std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+/*!
+    \brief Build a CSR graph from a flat buffer of interleaved edges.
+
+    edges = [source0, target0, source1, target1, ...]; its size must be even.
+*/
+csr_graph_t
+makeCsrGraph(
+    int nodeCount
+    , std::span<int const> edges
+    , std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+/*!
+    \brief Build the same CSR graph as makeCsrGraph() with up to 'threadCount' threads.
+
+    Each thread counts out-degrees over its own range of edges into a private
+    histogram, the histograms are prefix summed into per thread cursors, and
+    each thread scatters its own edges, so rows keep the order of 'edges'
+    exactly as the sequential builder does.  Small edge lists are built by
+    the calling thread alone.
+
+    Time = O(E / T + V), Space = O(T * V) histograms on top of the graph.
+*/
+csr_graph_t
+makeCsrGraphParallel(
+    int nodeCount
+    , std::vector<std::vector<int>> const& edges
+    , unsigned threadCount
+    , std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+csr_graph_t
+makeCsrGraphParallel(
+    int nodeCount
+    , std::span<std::pair<int, int> const> edges
+    , unsigned threadCount
+    , std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+csr_graph_t
+makeCsrGraphParallel(
+    int nodeCount
+    , std::span<int const> edges
+    , unsigned threadCount
+    , std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+/*!
+    \brief Rebuild 'graph' in place from edges, reusing its buffers.
+
+    Same as makeCsrGraph() but no heap allocation is performed when 'graph'
+    already has enough capacity, e.g. when it is reused across calls.
+*/
+void
+assignCsrGraph(csr_graph_t& graph, int nodeCount, std::vector<std::vector<int>> const& edges);
+
+void
+assignCsrGraph(csr_graph_t& graph, int nodeCount, std::span<std::pair<int, int> const> edges);
+
+void
+assignCsrGraph(csr_graph_t& graph, int nodeCount, std::span<int const> edges);
+
+/*!
+    \brief Rebuild 'reversed' in place as 'graph' with every edge turned around.
+
+    Row 'n' of 'reversed' lists the sources of the edges into 'n', in
+    ascending source order.  Reuses the buffers of 'reversed' like
+    assignCsrGraph().
+*/
+void
+assignReversedCsrGraph(csr_graph_t& reversed, csr_graph_view_t graph);
+
+#endif // #ifndef CSR_GRAPH_HPP_E5610060_D188_4BC4_BD1C_B9A05A376D75
+
+/*
+    End of "csr_graph.hpp"
+*/
@@ -0,0 +1,268 @@
+/*!
+    \file "fuzz.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Randomized differential tests: every course schedule engine must agree on
+    generated acyclic and cyclic catalogs.
+
+    Environment:
+      * COURSE_SCHEDULE_FUZZ_SEED:       base seed (default 1).  Failures print
+                                         the seed and iteration to replay.
+      * COURSE_SCHEDULE_FUZZ_ITERATIONS: catalogs per test case (default 200).
+*/
+
+//!\sa https://github.com/doctest/doctest/blob/master/doc/markdown/main.md
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "compact_catalog.hpp"
+#include "course_schedule.hpp"
+#include "utils.hpp"
+#include "workloads.hpp"
+
+#include <cstdlib>
+
+// {----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------}
+
+namespace doctest {
+    const char* testName() noexcept { return doctest::detail::g_cs->currentTest->m_name; }
+} // namespace doctest {
+
+namespace {
+
+unsigned long
+environmentValue(char const* name, unsigned long defaultValue) {
+    auto const value = getenv(name);
+    return value ? strtoul(value, nullptr, 10) : defaultValue;
+}
+
+uint32_t
+baseSeed() { return static_cast<uint32_t>(environmentValue("COURSE_SCHEDULE_FUZZ_SEED", 1)); }
+
+int
+iterationCount() { return static_cast<int>(environmentValue("COURSE_SCHEDULE_FUZZ_ITERATIONS", 200)); }
+
+//! Random acyclic catalog with up to 'maxCourses' courses and on average up to four prerequisites per course.
+workload_t
+randomDag(mt19937& random, int maxCourses) {
+    auto const numCourses = uniform_int_distribution<int>{2, maxCourses}(random);
+    auto const maxEdges = (min)(4LL * numCourses, static_cast<long long>(numCourses) * (numCourses - 1) / 2);
+    auto const edgeCount = uniform_int_distribution<int>{0, static_cast<int>(maxEdges)}(random);
+    return makeRandomDagWorkload(numCourses, edgeCount, static_cast<uint32_t>(random()));
+}
+
+//! True when every prerequisite precedes its course in 'order' and 'order' holds every course once.
+bool
+isValidOrder(workload_t const& catalog, vector<int> const& order) {
+    if (static_cast<int>(order.size()) != catalog.numCourses) { return false; }
+
+    vector<int> positions(static_cast<size_t>(catalog.numCourses), -1);
+    for (int position = 0; catalog.numCourses > position; ++position) {
+        auto& coursePosition = positions[static_cast<size_t>(order[static_cast<size_t>(position)])];
+        if (-1 != coursePosition) { return false; }
+        coursePosition = position;
+    }
+
+    return all_of(catalog.prerequisites.begin(), catalog.prerequisites.end(), [&](auto const& prerequisite) {
+        return positions[static_cast<size_t>(prerequisite.second)] < positions[static_cast<size_t>(prerequisite.first)];
+    });
+}
+
+//! True when cycle[i] requires cycle[i + 1] (and the last requires the first) for a non-empty 'cycle'.
+bool
+isValidCycle(workload_t const& catalog, vector<int> const& cycle) {
+    if (cycle.empty()) { return false; }
+
+    set<pair<int, int>> const prerequisites(catalog.prerequisites.begin(), catalog.prerequisites.end());
+    for (size_t idx = 0; cycle.size() > idx; ++idx) {
+        if (!prerequisites.contains({cycle[idx], cycle[(idx + 1) % cycle.size()]})) { return false; }
+    }
+    return true;
+}
+
+/*!
+    \brief True when 'plan' is a valid semester plan for the acyclic 'catalog' with at most 'cap' courses per semester.
+
+    Every course is taken after all of its prerequisites, and its level exceeds theirs.
+*/
+bool
+isValidSemesterPlan(workload_t const& catalog, Solution2_TopologicalSort::semester_plan_t const& plan, int cap) {
+    auto const courseCount = static_cast<size_t>(catalog.numCourses);
+    if (courseCount != plan.levels.size() || courseCount != plan.semesters.size()) { return false; }
+
+    vector<int> semesterLoads(static_cast<size_t>(plan.semesterCount), 0);
+    for (auto const semester : plan.semesters) {
+        if (0 > semester || plan.semesterCount <= semester) { return false; }
+        if (cap < ++semesterLoads[static_cast<size_t>(semester)]) { return false; }
+    }
+
+    auto const maxLevel = plan.levels.empty() ? -1 : *max_element(plan.levels.begin(), plan.levels.end());
+    return maxLevel + 1 == plan.criticalPathLength
+        && all_of(catalog.prerequisites.begin(), catalog.prerequisites.end(), [&](auto const& prerequisite) {
+            auto const course = static_cast<size_t>(prerequisite.first);
+            auto const required = static_cast<size_t>(prerequisite.second);
+            return plan.semesters[required] < plan.semesters[course] && plan.levels[required] < plan.levels[course];
+        });
+}
+
+/*!
+    \brief Run every engine on 'catalog' and check that they agree with each other.
+
+    'expected' is the known answer when the generator guarantees one.
+*/
+void
+checkEngines(workload_t const& catalog, optional<bool> expected, uint32_t seed, int iteration) {
+    auto const prerequisites = span<pair<int, int> const>{catalog.prerequisites};
+    auto prerequisiteVectors = vector<vector<int>>{};
+    for (auto const& [course, prerequisite] : catalog.prerequisites) {
+        prerequisiteVectors.push_back({course, prerequisite});
+    }
+
+    auto const reference = Solution2_TopologicalSort{}.canFinish(catalog.numCourses, prerequisites);
+
+    auto const dfs = Solution1_DFS{}.canFinish(catalog.numCourses, prerequisiteVectors);
+    auto const iterativeDfs = Solution3_IterativeDFS{}.canFinish(catalog.numCourses, prerequisites);
+    auto const parallelTopologicalSort = Solution4_ParallelTopologicalSort{4}.canFinish(
+        catalog.numCourses
+        , prerequisites
+    );
+    auto const tarjan = Solution5_TarjanSCC{}.canFinish(catalog.numCourses, prerequisites);
+    auto const parallelDfs = Solution7_ParallelDFS{4}.canFinish(catalog.numCourses, prerequisites);
+    auto const bitsetReachability = Solution6_BitsetReachability{}.canFinish(catalog.numCourses, prerequisites);
+    auto const precheckedTopologicalSort = Prechecked<Solution2_TopologicalSort>{}.canFinish(
+        catalog.numCourses
+        , prerequisites
+    );
+    auto const precheckedIterativeDfs = Prechecked<Solution3_IterativeDFS>{}.canFinish(
+        catalog.numCourses
+        , prerequisiteVectors
+    );
+
+    auto incremental = IncrementalCourseSchedule{catalog.numCourses};
+    auto incrementalAcceptedAll = true;
+    for (auto const& [course, prerequisite] : catalog.prerequisites) {
+        incrementalAcceptedAll = incremental.addPrerequisite(course, prerequisite) && incrementalAcceptedAll;
+    }
+
+    auto const order = Solution2_TopologicalSort{}.findOrder(catalog.numCourses, prerequisiteVectors);
+    auto const schedule = Solution3_IterativeDFS{}.findOrderOrCycle(catalog.numCourses, prerequisiteVectors);
+    auto const components = Solution5_TarjanSCC{}.diagnose(catalog.numCourses, prerequisiteVectors);
+    auto const semesterPlan = Solution2_TopologicalSort{}.planSemesters(catalog.numCourses, prerequisiteVectors, 3);
+
+    // Half of the catalog as the shared base, the other half as one overlay query.
+    auto const baseSize = prerequisites.size() / 2;
+    auto batch = BatchCourseSchedule{catalog.numCourses, prerequisites.first(baseSize), 2};
+    auto const batchCanFinish = batch.canFinish(prerequisites.subspan(baseSize));
+
+    // Spread the courses over sparse 64 bit ids; the compact graph must give the same answer.
+    auto sparsePrerequisites = vector<pair<int64_t, int64_t>>{};
+    for (auto const& [course, prerequisite] : catalog.prerequisites) {
+        auto const sparseId = [](int id) { return int64_t{id} * 1'000'003 - (int64_t{1} << 40); };
+        sparsePrerequisites.emplace_back(sparseId(course), sparseId(prerequisite));
+    }
+    auto const compactCanFinish = Solution2_TopologicalSort{}.canFinish(compactCatalog(sparsePrerequisites).graph);
+
+    auto const agree = (!expected || *expected == reference)
+        && reference == dfs
+        && reference == iterativeDfs
+        && reference == parallelTopologicalSort
+        && reference == tarjan
+        && reference == parallelDfs
+        && reference == bitsetReachability
+        && reference == precheckedTopologicalSort
+        && reference == precheckedIterativeDfs
+        && reference == components.cyclicComponents.empty()
+        && reference == batchCanFinish
+        && reference == compactCanFinish
+        && reference == incrementalAcceptedAll
+        && (reference ? isValidOrder(catalog, order) : order.empty())
+        && reference == semesterPlan.canFinish
+        && (reference ? isValidSemesterPlan(catalog, semesterPlan, 3) : semesterPlan.levels.empty())
+        && reference == schedule.canFinish
+        && (reference ? isValidOrder(catalog, schedule.order) : isValidCycle(catalog, schedule.cycle));
+    if (!agree) {
+        cerr << "Engines disagree: replay with COURSE_SCHEDULE_FUZZ_SEED=" << seed
+             << " (iteration " << iteration << ", " << catalog.numCourses << " courses, "
+             << catalog.prerequisites.size() << " prerequisites)\n";
+    }
+    CHECK(agree);
+}
+
+} // namespace {
+
+TEST_CASE("Fuzz 1")
+{
+    cerr << doctest::testName() << ": random acyclic catalogs\n";
+    auto const seed = baseSeed();
+    auto random = mt19937{seed};
+    auto const start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iterationCount() > iteration; ++iteration) {
+        checkEngines(randomDag(random, 3000), true, seed, iteration);
+    }
+    cerr << "Elapsed time: " << elapsed_time_t{start} << "\n\n";
+}
+
+TEST_CASE("Fuzz 2")
+{
+    cerr << doctest::testName() << ": acyclic catalogs closed by one reversed prerequisite or a self-loop\n";
+    auto const seed = baseSeed() + 1;
+    auto random = mt19937{seed};
+    auto const start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iterationCount() > iteration; ++iteration) {
+        auto catalog = randomDag(random, 3000);
+        if (catalog.prerequisites.empty() || 0 == random() % 4) {
+            auto const course = uniform_int_distribution<int>{0, catalog.numCourses - 1}(random);
+            catalog.prerequisites.emplace_back(course, course);
+        } else {
+            auto const& closed = catalog.prerequisites[random() % catalog.prerequisites.size()];
+            catalog.prerequisites.emplace_back(closed.second, closed.first);
+        }
+        shuffle(catalog.prerequisites.begin(), catalog.prerequisites.end(), random);
+        checkEngines(catalog, false, seed, iteration);
+    }
+    cerr << "Elapsed time: " << elapsed_time_t{start} << "\n\n";
+}
+
+TEST_CASE("Fuzz 3")
+{
+    cerr << doctest::testName() << ": acyclic catalogs plus random (possibly duplicate) prerequisites\n";
+    auto const seed = baseSeed() + 2;
+    auto random = mt19937{seed};
+    auto const start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iterationCount() > iteration; ++iteration) {
+        auto catalog = randomDag(random, 3000);
+        auto pick = uniform_int_distribution<int>{0, catalog.numCourses - 1};
+        for (auto extra = random() % 4; extra; --extra) {
+            catalog.prerequisites.emplace_back(pick(random), pick(random));
+        }
+        checkEngines(catalog, nullopt, seed, iteration);
+    }
+    cerr << "Elapsed time: " << elapsed_time_t{start} << "\n\n";
+}
+
+TEST_CASE("Fuzz 4")
+{
+    cerr << doctest::testName() << ": wide layered catalogs, with and without a closing prerequisite\n";
+    auto const seed = baseSeed() + 3;
+    auto random = mt19937{seed};
+    auto const start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iterationCount() / 10 > iteration; ++iteration) {
+        auto catalog = makeWideDagWorkload(
+            uniform_int_distribution<int>{1000, 100000}(random)
+            , static_cast<uint32_t>(random())
+        );
+        auto const closeCycle = 0 == random() % 2;
+        if (closeCycle) {
+            auto const& closed = catalog.prerequisites[random() % catalog.prerequisites.size()];
+            catalog.prerequisites.emplace_back(closed.second, closed.first);
+        }
+        checkEngines(catalog, !closeCycle, seed, iteration);
+    }
+    cerr << "Elapsed time: " << elapsed_time_t{start} << "\n\n";
+}
+
+/*
+    End of "fuzz.cpp"
+*/
@@ -0,0 +1,145 @@
+/*!
+    \file "instrumentation.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Opt-in hot path counters for the course schedule engines.
+
+    Build with COURSE_SCHEDULE_INSTRUMENTATION=1 (CMake option of the same
+    name) to record counters.  Otherwise every COURSE_SCHEDULE_* macro below
+    expands to nothing and its arguments are never evaluated, so the engines
+    compile to exactly the uninstrumented code.
+
+    Counters accumulate per thread until takeEngineCounters() returns and
+    clears them, so a caller brackets each canFinish() call with it:
+
+        takeEngineCounters();
+        solution.canFinish(numCourses, prerequisites);
+        writeEngineCountersJson(std::cout, "Solution2_TopologicalSort", takeEngineCounters());
+*/
+
+#ifndef INSTRUMENTATION_HPP_5DD521BE_1645_426C_B9FB_1BC4266BA55A
+#define INSTRUMENTATION_HPP_5DD521BE_1645_426C_B9FB_1BC4266BA55A
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+#ifndef COURSE_SCHEDULE_INSTRUMENTATION
+#define COURSE_SCHEDULE_INSTRUMENTATION 0
+#endif
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+//! Work done by the engines on the current thread since the last takeEngineCounters().
+struct engine_counters_t
+{
+    std::uint64_t edgesScanned{}; //!< Prerequisites followed during traversal.
+    std::uint64_t nodesVisited{}; //!< Courses expanded during traversal.
+    std::uint64_t maxDepth{}; //!< Deepest DFS branch (Solution1_DFS).
+    std::uint64_t queueHighWater{}; //!< Most courses waiting in the que at once (Solution2_TopologicalSort).
+    std::uint64_t allocations{}; //!< Upstream allocations made by per-call arenas.
+    std::uint64_t buildNanoseconds{}; //!< Time spent building CSR graphs.
+    std::uint64_t traversalNanoseconds{}; //!< Time spent searching them.
+};
+
+inline engine_counters_t&
+engineCounters() noexcept {
+    thread_local engine_counters_t counters{};
+    return counters;
+}
+
+//! Return the counters recorded on this thread and reset them.
+inline engine_counters_t
+takeEngineCounters() noexcept {
+    auto const counters = engineCounters();
+    engineCounters() = {};
+    return counters;
+}
+
+//! Write 'counters' as one JSON object (one line), ready for a JSON lines log.
+inline std::ostream&
+writeEngineCountersJson(std::ostream& os, std::string_view engine, engine_counters_t const& counters) {
+    return os << "{\"engine\":\"" << engine << '"'
+        << ",\"edgesScanned\":" << counters.edgesScanned
+        << ",\"nodesVisited\":" << counters.nodesVisited
+        << ",\"maxDepth\":" << counters.maxDepth
+        << ",\"queueHighWater\":" << counters.queueHighWater
+        << ",\"allocations\":" << counters.allocations
+        << ",\"buildNanoseconds\":" << counters.buildNanoseconds
+        << ",\"traversalNanoseconds\":" << counters.traversalNanoseconds
+        << "}\n";
+}
+
+//! Adds the lifetime of the timer to a nanosecond counter.
+class engine_timer_t {
+    std::uint64_t& nanoseconds_;
+    std::chrono::steady_clock::time_point const start_{std::chrono::steady_clock::now()};
+
+public:
+    explicit engine_timer_t(std::uint64_t& nanoseconds) noexcept : nanoseconds_{nanoseconds} {}
+
+    engine_timer_t(engine_timer_t const&) = delete;
+    engine_timer_t& operator=(engine_timer_t const&) = delete;
+
+    ~engine_timer_t() {
+        auto const elapsed = std::chrono::steady_clock::now() - start_;
+        nanoseconds_ += static_cast<std::uint64_t>(std::chrono::nanoseconds{elapsed}.count());
+    }
+};
+
+//! Forwards to the default resource, counting each allocation in engineCounters().allocations.
+class counting_upstream_resource_t : public std::pmr::memory_resource {
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++engineCounters().allocations;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+};
+
+//! Upstream for the engines' per-call arenas.
+inline std::pmr::memory_resource*
+engineUpstreamResource() noexcept {
+#if COURSE_SCHEDULE_INSTRUMENTATION
+    static counting_upstream_resource_t counting{};
+    return &counting;
+#else
+    return std::pmr::get_default_resource();
+#endif
+}
+
+#if COURSE_SCHEDULE_INSTRUMENTATION
+// Constant evaluation (constexpr engine cores) has no counters to update.
+#define COURSE_SCHEDULE_COUNT(counter, amount) \
+    (std::is_constant_evaluated() \
+        ? void() \
+        : void(engineCounters().counter += static_cast<std::uint64_t>(amount)))
+#define COURSE_SCHEDULE_HIGH_WATER(counter, value) \
+    (std::is_constant_evaluated() \
+        ? void() \
+        : void(engineCounters().counter = (std::max)(engineCounters().counter, static_cast<std::uint64_t>(value))))
+#define COURSE_SCHEDULE_TIME_SCOPE(counter) \
+    engine_timer_t const engineTimer{engineCounters().counter}
+#else
+#define COURSE_SCHEDULE_COUNT(counter, amount) ((void)0)
+#define COURSE_SCHEDULE_HIGH_WATER(counter, value) ((void)0)
+#define COURSE_SCHEDULE_TIME_SCOPE(counter) ((void)0)
+#endif
+
+#endif // #ifndef INSTRUMENTATION_HPP_5DD521BE_1645_426C_B9FB_1BC4266BA55A
+
+/*
+    End of "instrumentation.hpp"
+*/
@@ -11,186 +11,13 @@
 //!\sa https://github.com/doctest/doctest/blob/master/doc/markdown/main.md
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 
+#include "compact_catalog.hpp"
+#include "course_schedule.hpp"
+#include "prerequisite_file.hpp"
 #include "utils.hpp"
 
-/*
-    There are a total of numCourses courses you have to take, labeled from 
-    0 to numCourses - 1. You are given an array prerequisites where 
-    prerequisites[i] = [ai, bi] indicates that you must take course bi first 
-    if you want to take course ai.
-
-        * For example, the pair [0, 1], indicates that to take course 0 you 
-          have to first take course 1.
-    
-    Return true if you can finish all courses. Otherwise, return false.
-
-    Constraints:
-
-        * 1 <= numCourses <= 2000
-        * 0 <= prerequisites.length <= 5000
-        * prerequisites[i].length == 2
-        * 0 <= ai, bi < numCourses
-        * All the pairs prerequisites[i] are unique.
-*/
-
-class Solution1_DFS {
-        using dependencies_t = vector<int>;
-        using courses_t = unordered_map<int, dependencies_t>;
-        using visited_t = unordered_set<int>;
-
-        static bool canFinishDFS(
-            courses_t& courses
-            , int course
-            , visited_t& visited
-        ) noexcept {
-            if (visited.contains(course)) { return false; }
-            
-            auto coursesIter = courses.find(course);
-            if (courses.end() == coursesIter) { return true; }
-            
-            dependencies_t const& dependencies = coursesIter->second;
-            if (!dependencies.empty()) {
-                auto const courseIter = visited.insert(course).first;
-
-                for (auto const dependency : dependencies) {
-                    if (!canFinishDFS(courses, dependency, visited)) {
-                        return false;
-                    }
-                }
-
-                visited.erase(courseIter);
-            }
-
-            courses.erase(coursesIter);
-            
-            return true;
-        }
-
-public:
-    /*
-        The prerequisites create a dependency tree.
-        Return true only when all branches in the tree contain no cycles.
-        
-        Populate a dictionary with all courses.  Keys are prerequisites[0],
-        values are arrays composed of prerequisites[1], which handles 
-        courses with more than one prerequisite.  Use a recursive depth
-        first search to visit each individual branch of the prerequisite
-        tree.  Remove the branch (or sub-branch) from the tree after 
-        visiting it (DP).  As each node in the branch is visited, check
-        to see if it was already visited.  If it was then there is a cyclic
-        dependency in the branch, which results in false being returned.
-        Add branch nodes to the visited collection as the branch is traversed
-        from root to tip and remove the added nodes as the stack unwinds back
-        from tip to root (backtracking).
-
-        Time = O(n)
-               n = number of prerequisites.  Prerequisite tree branch nodes
-                   are removed from the prerequisite tree after being visited,
-                   so the maximum number of nodes that can ever possibly be 
-                   visited is n.
-
-        Space = O(n)
-                n = maximum call stack depth when all prerequisites reference
-                    each other and create a linear chain.
-    */
-    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
-        courses_t courses{};
-        for (auto const& prerequisite : prerequisites) {
-            auto const course = prerequisite[0];
-            auto const dependency = prerequisite[1];
-            auto coursesIter = courses.find(course);
-            if (courses.end() != coursesIter) {
-                coursesIter->second.push_back(dependency);
-            } else {
-                courses.insert(make_pair(course, dependencies_t{dependency}));
-            }
-        }
-
-        visited_t visited{};
-        while (!courses.empty()) {
-            auto const course = courses.begin()->first;
-            if (!canFinishDFS(courses, course, visited)) {
-                return false;
-            }
-        }
-
-        return true;
-    }
-};
-
-class Solution2_TopologicalSort {
-public:
-    /*
-        The prerequisites create a dependency tree.
-        Return true only when all branches in the tree contain no cycles.
-        
-        Use a topological sort to detect cycles.
-          1) Create a graph (adjacency list) from the prerequisites.
-          2) Count the number of edges coming in to a node (it's in-degree).
-          3) Push the nodes with an in-degree of zero (0) on to the que.
-          4) While the queue is not empty:
-        4.1)   Pop node ('A') off of que.
-        4.2)   Decrement the in-degree of each node referenced by 'A', i.e.
-               each node that can be reached by following an edge from 'A'.
-        4.3)   If the in-degree of a node becomes zero (0), push the node 
-               on to the que.
-          5) If the number of nodes pushed to or popped from the que is equal
-             to the number of nodes in the graph then there are no cycles in
-             the dependency tree and the result is true.
-
-        Time = O(V + V + E + V + V) => O(4V + E) => O(V+E)
-               V = vertex count == numCourses
-               E = edge count == len(prerequisites)
-               Term 1: inDegrees allocation.
-               Term 2: graph allocation.
-               Term 3: graph population.
-               Term 4: queue initialization.
-               Term 5: queue processing.
-
-        Space = O(V + V*V + V) => O(2V + V**2) => O(V**2)
-                V = vertex count == numCourses
-                Term 1: inDegrees capacity
-                Term 2: graph capacity (all nodes could reference each other).
-                Term 3: queue capacity (all nodes when none reference any other).
-    */
-    bool canFinish(int numCourses, vector<vector<int>>& prerequisites) {
-        // Create graph [adjacency list] and in-degree counts from prerequisites.
-        int inDegrees[numCourses];
-        memset(inDegrees, 0, sizeof(inDegrees));
-        vector<int> graph[numCourses];
-        for (auto const& edge : prerequisites) {
-            graph[edge[0]].push_back(edge[1]);
-            ++inDegrees[edge[1]];
-        }
-
-        // Initialize queue with nodes that have an in-degree count of zero.
-        deque<int> que{};
-        for (int node = 0; numCourses > node; ++node) {
-            if (0 == inDegrees[node]) {
-                que.push_back(node);
-            }
-        }
-
-        int visitCount = static_cast<int>(que.size());
-
-        // Remove each node from graph until all removed or cycle detected.
-        while (!que.empty()) {
-            auto const node = que.front();
-            que.pop_front();
-
-            // "Remove" node from graph.
-            for (auto const neighbor : graph[node]) {
-                if (0 == --inDegrees[neighbor]) {
-                    que.push_back(neighbor);
-                    ++visitCount;
-                }
-            }
-        }
-
-        auto const noCycleDetected = visitCount == numCourses;
-        return noCycleDetected;
-    }
-};
+#include <filesystem>
+#include <fstream>
 
 // {----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------}
 
@@ -362,6 +189,49 @@ TEST_CASE("Case 8")
     cerr << "\n";
 }
 
+TEST_CASE("Case 9")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = vector<pair<int, int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution1_DFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 10")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto const prerequisites = vector<int>{
+        1,0,
+        2,0,
+        0,2
+    };
+    auto const expected = false;
+    auto solution = Solution1_DFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<int const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
 TEST_CASE("Case 21")
 {
     cerr << doctest::testName() << '\n';
@@ -526,6 +396,2447 @@ TEST_CASE("Case 28")
     cerr << "\n";
 }
 
+TEST_CASE("Case 29")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = vector<pair<int, int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 30")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto const prerequisites = vector<int>{
+        1,0,
+        2,0,
+        0,2
+    };
+    auto const expected = false;
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<int const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 31")
+{
+    cerr << doctest::testName() << '\n';
+    struct catalog_t { int numCourses; vector<vector<int>> prerequisites; bool expected; };
+    auto catalogs = vector<catalog_t>{
+        {8, {{1,0},{2,6},{1,7},{6,4},{7,0},{0,5}}, true},
+        {2, {{1,0},{0,1}}, false},
+        {20, {{0,10},{3,18},{5,5},{6,11},{11,14},{13,1},{15,1},{17,4}}, false},
+        {5, {{1,4},{2,4},{3,1},{3,2}}, true},
+        {3, {{1,0},{1,2},{0,1}}, false},
+        {2, {{1,0}}, true},
+    };
+    auto solution = Solution2_TopologicalSort{};
+    auto workspace = Solution2_TopologicalSort::Workspace{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        for (auto& catalog : catalogs) {
+            auto const result = solution.canFinish(catalog.numCourses, catalog.prerequisites, workspace);
+            CHECK(catalog.expected == result);
+        }
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 32")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 1000000;
+    auto prerequisites = vector<vector<int>>{};
+    prerequisites.reserve(numCourses - 1);
+    for (int course = 1; numCourses > course; ++course) {
+        prerequisites.push_back({course, course - 1});
+    }
+    auto const expected = true;
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 33")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expected = vector<int>{4,2,1,3,0};
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.findOrder(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 34")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expected = vector<int>{};
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.findOrder(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 35")
+{
+    cerr << doctest::testName() << '\n';
+    // One-off calls build everything in a per-call arena: a constant number of upstream allocations.
+    struct counting_resource_t : pmr::memory_resource {
+        size_t allocationCount{};
+
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            ++allocationCount;
+            return pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+            pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(memory_resource const& other) const noexcept override { return this == &other; }
+    };
+
+    auto const numCourses = 2000;
+    auto random = mt19937{35};
+    auto pick = uniform_int_distribution<int>{0, numCourses - 1};
+    auto prerequisites = vector<vector<int>>{};
+    for (int prerequisiteIdx = 0; 5000 > prerequisiteIdx; ++prerequisiteIdx) {
+        auto const first = pick(random);
+        auto const second = pick(random);
+        auto const [low, high] = minmax(first, second);
+        if (low != high) { prerequisites.push_back({high, low}); }
+    }
+
+    counting_resource_t counting{};
+    auto* const previous = pmr::set_default_resource(&counting);
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(Solution1_DFS{}.canFinish(numCourses, prerequisites));
+        CHECK(1 == counting.allocationCount);
+        counting.allocationCount = 0;
+        CHECK(Solution2_TopologicalSort{}.canFinish(numCourses, prerequisites));
+        CHECK(1 == counting.allocationCount);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    pmr::set_default_resource(previous);
+    cerr << "\n";
+}
+
+TEST_CASE("Case 36")
+{
+    cerr << doctest::testName() << '\n';
+    // Hot path counters: recorded only in COURSE_SCHEDULE_INSTRUMENTATION builds, all zero otherwise.
+    auto const numCourses = 6;
+    auto prerequisites = vector<vector<int>>{
+        {0,1},{1,2},{2,3},{4,3},{5,3}
+    };
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        takeEngineCounters();
+        CHECK(Solution2_TopologicalSort{}.canFinish(numCourses, prerequisites));
+        auto const topologicalSort = takeEngineCounters();
+        CHECK(Solution1_DFS{}.canFinish(numCourses, prerequisites));
+        auto const dfs = takeEngineCounters();
+        writeEngineCountersJson(cerr, "Solution2_TopologicalSort", topologicalSort);
+        writeEngineCountersJson(cerr, "Solution1_DFS", dfs);
+#if COURSE_SCHEDULE_INSTRUMENTATION
+        CHECK(6 == topologicalSort.nodesVisited);
+        CHECK(5 == topologicalSort.edgesScanned);
+        CHECK(3 == topologicalSort.queueHighWater);
+        CHECK(1 == topologicalSort.allocations);
+        CHECK(6 == dfs.nodesVisited);
+        CHECK(5 == dfs.edgesScanned);
+        CHECK(3 == dfs.maxDepth);
+        CHECK(1 == dfs.allocations);
+#else
+        CHECK(0 == topologicalSort.nodesVisited + topologicalSort.edgesScanned + topologicalSort.allocations);
+        CHECK(0 == dfs.nodesVisited + dfs.maxDepth + dfs.buildNanoseconds + dfs.traversalNanoseconds);
+#endif
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+// Fixed catalogs checked at compile time; a bad catalog here fails the build.
+constexpr auto case1Catalog = array<pair<int, int>, 1>{{{1,0}}};
+constexpr auto case2Catalog = array<pair<int, int>, 2>{{{1,0},{0,1}}};
+constexpr auto case5Catalog = array<pair<int, int>, 8>{{
+    {0,10},{3,18},{5,5},{6,11},{11,14},{13,1},{15,1},{17,4}
+}};
+constexpr auto case9Catalog = array<pair<int, int>, 6>{{
+    {1,0},{2,6},{1,7},{6,4},{7,0},{0,5}
+}};
+static_assert(Solution2_TopologicalSort::canFinish<2>(case1Catalog));
+static_assert(!Solution2_TopologicalSort::canFinish<2>(case2Catalog));
+static_assert(!Solution2_TopologicalSort::canFinish<20>(case5Catalog));
+static_assert(Solution2_TopologicalSort::canFinish<8>(case9Catalog));
+static_assert(Solution2_TopologicalSort::canFinish<3>(array<pair<int, int>, 0>{}));
+
+TEST_CASE("Case 37")
+{
+    cerr << doctest::testName() << '\n';
+    // The constexpr entry point agrees with the runtime engine when evaluated at run time too.
+    auto const catalog = case9Catalog;
+    auto prerequisites = vector<vector<int>>{};
+    for (auto const& [course, prerequisite] : catalog) {
+        prerequisites.push_back({course, prerequisite});
+    }
+    auto const expected = true;
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(expected == Solution2_TopologicalSort::canFinish<8>(catalog));
+        CHECK(expected == Solution2_TopologicalSort{}.canFinish(8, prerequisites));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 38")
+{
+    cerr << doctest::testName() << '\n';
+    // Diamond 0 -> {1, 2} -> 3 plus the independent course 4.
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,0},
+        {3,1},
+        {3,2}
+    };
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const plan = solution.planSemesters(numCourses, prerequisites, 2);
+        CHECK(plan.canFinish);
+        CHECK(vector<int>{0,1,1,2,0} == plan.levels);
+        CHECK(3 == plan.criticalPathLength);
+        CHECK(vector<int>{0,1,1,2,0} == plan.semesters);
+        CHECK(3 == plan.semesterCount);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const plan = solution.planSemesters(numCourses, prerequisites, 1);
+        CHECK(plan.canFinish);
+        CHECK(vector<int>{0,1,1,2,0} == plan.levels);
+        CHECK(3 == plan.criticalPathLength);
+        CHECK(vector<int>{0,2,3,4,1} == plan.semesters);
+        CHECK(5 == plan.semesterCount);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 39")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 4;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,1},
+        {1,2},
+        {3,0}
+    };
+    auto solution = Solution2_TopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const plan = solution.planSemesters(numCourses, prerequisites, 3);
+        CHECK(!plan.canFinish);
+        CHECK(plan.levels.empty());
+        CHECK(plan.semesters.empty());
+        CHECK(0 == plan.criticalPathLength);
+        CHECK(0 == plan.semesterCount);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 41")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0}
+    };
+    auto const expected = true;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 42")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {0,1},
+    };
+    auto const expected = false;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 43")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expected = true;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 44")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 45")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expected = false;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 46")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,0},
+        {0,2}
+    };
+    auto const expected = false;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 47")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expected = false;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 48")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 100;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,0},{2,1},{3,1},{3,2},{4,2},{4,3},{5,3},{5,4},{6,4},{6,5},{7,5},{7,6},{8,6},{8,7},{9,7},{9,8},{10,8},{10,9},{11,9},{11,10},{12,10},{12,11},{13,11},{13,12},{14,12},{14,13},{15,13},{15,14},{16,14},{16,15},{17,15},{17,16},{18,16},{18,17},{19,17},{19,18},{20,18},{20,19},{21,19},{21,20},{22,20},{22,21},{23,21},{23,22},{24,22},{24,23},{25,23},{25,24},{26,24},{26,25},{27,25},{27,26},{28,26},{28,27},{29,27},{29,28},{30,28},{30,29},{31,29},{31,30},{32,30},{32,31},{33,31},{33,32},{34,32},{34,33},{35,33},{35,34},{36,34},{36,35},{37,35},{37,36},{38,36},{38,37},{39,37},{39,38},{40,38},{40,39},{41,39},{41,40},{42,40},{42,41},{43,41},{43,42},{44,42},{44,43},{45,43},{45,44},{46,44},{46,45},{47,45},{47,46},{48,46},{48,47},{49,47},{49,48},{50,48},{50,49},{51,49},{51,50},{52,50},{52,51},{53,51},{53,52},{54,52},{54,53},{55,53},{55,54},{56,54},{56,55},{57,55},{57,56},{58,56},{58,57},{59,57},{59,58},{60,58},{60,59},{61,59},{61,60},{62,60},{62,61},{63,61},{63,62},{64,62},{64,63},{65,63},{65,64},{66,64},{66,65},{67,65},{67,66},{68,66},{68,67},{69,67},{69,68},{70,68},{70,69},{71,69},{71,70},{72,70},{72,71},{73,71},{73,72},{74,72},{74,73},{75,73},{75,74},{76,74},{76,75},{77,75},{77,76},{78,76},{78,77},{79,77},{79,78},{80,78},{80,79},{81,79},{81,80},{82,80},{82,81},{83,81},{83,82},{84,82},{84,83},{85,83},{85,84},{86,84},{86,85},{87,85},{87,86},{88,86},{88,87},{89,87},{89,88},{90,88},{90,89},{91,89},{91,90},{92,90},{92,91},{93,91},{93,92},{94,92},{94,93},{95,93},{95,94},{96,94},{96,95},{97,95},{97,96},{98,96},{98,97},{99,97}
+    };
+    auto const expected = true;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 49")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 1000000;
+    auto prerequisites = vector<vector<int>>{};
+    prerequisites.reserve(numCourses - 1);
+    for (int course = 1; numCourses > course; ++course) {
+        prerequisites.push_back({course, course - 1});
+    }
+    auto const expected = true;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 50")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 1000000;
+    auto prerequisites = vector<vector<int>>{};
+    prerequisites.reserve(numCourses);
+    for (int course = 1; numCourses > course; ++course) {
+        prerequisites.push_back({course, course - 1});
+    }
+    prerequisites.push_back({0, numCourses - 1});
+    auto const expected = false;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 51")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = vector<pair<int, int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 52")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto const prerequisites = vector<int>{
+        1,0,
+        2,0,
+        0,2
+    };
+    auto const expected = false;
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<int const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 53")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expectedOrder = vector<int>{0,4,1,2,3};
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.findOrderOrCycle(numCourses, prerequisites);
+        CHECK(result.canFinish);
+        CHECK(expectedOrder == result.order);
+        CHECK(result.cycle.empty());
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 54")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expectedCycle = vector<int>{0,1};
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.findOrderOrCycle(numCourses, prerequisites);
+        CHECK_FALSE(result.canFinish);
+        CHECK(result.order.empty());
+        CHECK(expectedCycle == result.cycle);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 55")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expectedCycle = vector<int>{5};
+    auto solution = Solution3_IterativeDFS{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.findOrderOrCycle(numCourses, prerequisites);
+        CHECK_FALSE(result.canFinish);
+        CHECK(expectedCycle == result.cycle);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 61")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0}
+    };
+    auto const expected = true;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 62")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {0,1},
+    };
+    auto const expected = false;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 63")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expected = true;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 64")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 65")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expected = false;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 66")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,0},
+        {0,2}
+    };
+    auto const expected = false;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 67")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expected = false;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 68")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 100;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,0},{2,1},{3,1},{3,2},{4,2},{4,3},{5,3},{5,4},{6,4},{6,5},{7,5},{7,6},{8,6},{8,7},{9,7},{9,8},{10,8},{10,9},{11,9},{11,10},{12,10},{12,11},{13,11},{13,12},{14,12},{14,13},{15,13},{15,14},{16,14},{16,15},{17,15},{17,16},{18,16},{18,17},{19,17},{19,18},{20,18},{20,19},{21,19},{21,20},{22,20},{22,21},{23,21},{23,22},{24,22},{24,23},{25,23},{25,24},{26,24},{26,25},{27,25},{27,26},{28,26},{28,27},{29,27},{29,28},{30,28},{30,29},{31,29},{31,30},{32,30},{32,31},{33,31},{33,32},{34,32},{34,33},{35,33},{35,34},{36,34},{36,35},{37,35},{37,36},{38,36},{38,37},{39,37},{39,38},{40,38},{40,39},{41,39},{41,40},{42,40},{42,41},{43,41},{43,42},{44,42},{44,43},{45,43},{45,44},{46,44},{46,45},{47,45},{47,46},{48,46},{48,47},{49,47},{49,48},{50,48},{50,49},{51,49},{51,50},{52,50},{52,51},{53,51},{53,52},{54,52},{54,53},{55,53},{55,54},{56,54},{56,55},{57,55},{57,56},{58,56},{58,57},{59,57},{59,58},{60,58},{60,59},{61,59},{61,60},{62,60},{62,61},{63,61},{63,62},{64,62},{64,63},{65,63},{65,64},{66,64},{66,65},{67,65},{67,66},{68,66},{68,67},{69,67},{69,68},{70,68},{70,69},{71,69},{71,70},{72,70},{72,71},{73,71},{73,72},{74,72},{74,73},{75,73},{75,74},{76,74},{76,75},{77,75},{77,76},{78,76},{78,77},{79,77},{79,78},{80,78},{80,79},{81,79},{81,80},{82,80},{82,81},{83,81},{83,82},{84,82},{84,83},{85,83},{85,84},{86,84},{86,85},{87,85},{87,86},{88,86},{88,87},{89,87},{89,88},{90,88},{90,89},{91,89},{91,90},{92,90},{92,91},{93,91},{93,92},{94,92},{94,93},{95,93},{95,94},{96,94},{96,95},{97,95},{97,96},{98,96},{98,97},{99,97}
+    };
+    auto const expected = true;
+    auto solution = Solution4_ParallelTopologicalSort{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 69")
+{
+    cerr << doctest::testName() << '\n';
+    // Wide layered catalog: every course in a layer depends on three courses in the previous layer.
+    auto const layerCount = 50;
+    auto const layerWidth = 4000;
+    auto const numCourses = layerCount * layerWidth;
+    auto random = mt19937{69};
+    auto pick = uniform_int_distribution<int>{0, layerWidth - 1};
+    auto prerequisites = vector<vector<int>>{};
+    for (int layer = 1; layerCount > layer; ++layer) {
+        for (int slot = 0; layerWidth > slot; ++slot) {
+            for (int edge = 0; 3 > edge; ++edge) {
+                prerequisites.push_back({layer * layerWidth + slot, (layer - 1) * layerWidth + pick(random)});
+            }
+        }
+    }
+    auto const expected = Solution2_TopologicalSort{}.canFinish(numCourses, prerequisites);
+    CHECK(expected);
+    auto solution = Solution4_ParallelTopologicalSort{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 70")
+{
+    cerr << doctest::testName() << '\n';
+    // Same wide layered catalog closed into a cycle by a single back edge.
+    auto const layerCount = 50;
+    auto const layerWidth = 4000;
+    auto const numCourses = layerCount * layerWidth;
+    auto random = mt19937{70};
+    auto pick = uniform_int_distribution<int>{0, layerWidth - 1};
+    auto prerequisites = vector<vector<int>>{};
+    for (int layer = 1; layerCount > layer; ++layer) {
+        for (int slot = 0; layerWidth > slot; ++slot) {
+            for (int edge = 0; 3 > edge; ++edge) {
+                prerequisites.push_back({layer * layerWidth + slot, (layer - 1) * layerWidth + pick(random)});
+            }
+        }
+    }
+    auto const& lastEdge = prerequisites.back();
+    prerequisites.push_back({lastEdge[1], lastEdge[0]});
+    auto const expected = Solution2_TopologicalSort{}.canFinish(numCourses, prerequisites);
+    CHECK_FALSE(expected);
+    auto solution = Solution4_ParallelTopologicalSort{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 71")
+{
+    cerr << doctest::testName() << '\n';
+    // The parallel CSR builder must reproduce the sequential graph exactly, row order included.
+    auto const numCourses = 50'000;
+    auto random = mt19937{71};
+    auto pick = uniform_int_distribution<int>{0, numCourses - 1};
+    auto prerequisites = vector<pair<int, int>>{};
+    auto flat = vector<int>{};
+    for (int prerequisiteIdx = 0; 1'000'000 > prerequisiteIdx; ++prerequisiteIdx) {
+        prerequisites.emplace_back(pick(random), pick(random));
+        flat.insert(flat.end(), {prerequisites.back().first, prerequisites.back().second});
+    }
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const expected = makeCsrGraph(numCourses, span<pair<int, int> const>{prerequisites});
+        for (auto const threadCount : {1u, 2u, 3u, 8u}) {
+            auto const graph = makeCsrGraphParallel(numCourses, span<pair<int, int> const>{prerequisites}, threadCount);
+            CHECK(expected.offsets == graph.offsets);
+            CHECK(expected.targets == graph.targets);
+        }
+        auto const interleaved = makeCsrGraphParallel(numCourses, span<int const>{flat}, 5);
+        CHECK(expected.offsets == interleaved.offsets);
+        CHECK(expected.targets == interleaved.targets);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 81")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 4;
+    auto const prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,1},
+        {3,2},
+        {0,3},
+        {0,2},
+        {3,1}
+    };
+    auto const expected = vector<bool>{true, true, true, false, false, true};
+    auto schedule = IncrementalCourseSchedule{numCourses};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto result = vector<bool>{};
+        for (auto const& prerequisite : prerequisites) {
+            result.push_back(schedule.addPrerequisite(prerequisite[0], prerequisite[1]));
+        }
+        CHECK(expected == result);
+        CHECK(vector<int>{0,1,2,3} == vector<int>(schedule.order().begin(), schedule.order().end()));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 82")
+{
+    cerr << doctest::testName() << '\n';
+    // Stream random prerequisites; each insert must agree with a from-scratch topological sort.
+    auto const numCourses = 200;
+    auto random = mt19937{82};
+    auto pick = uniform_int_distribution<int>{0, numCourses - 1};
+    auto schedule = IncrementalCourseSchedule{numCourses};
+    auto accepted = vector<vector<int>>{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        for (int insert = 0; 1500 > insert; ++insert) {
+            auto prerequisites = accepted;
+            prerequisites.push_back({pick(random), pick(random)});
+            auto const expected = Solution2_TopologicalSort{}.canFinish(numCourses, prerequisites);
+            auto const result = schedule.addPrerequisite(prerequisites.back()[0], prerequisites.back()[1]);
+            CHECK(expected == result);
+            if (result) {
+                accepted.push_back(prerequisites.back());
+            }
+        }
+
+        // The maintained order must place every prerequisite before its course.
+        auto positions = vector<int>(numCourses);
+        for (int position = 0; numCourses > position; ++position) {
+            positions[static_cast<size_t>(schedule.order()[static_cast<size_t>(position)])] = position;
+        }
+        for (auto const& prerequisite : accepted) {
+            CHECK(positions[static_cast<size_t>(prerequisite[1])] < positions[static_cast<size_t>(prerequisite[0])]);
+        }
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 91")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = parsePrerequisiteText("[[1,0],[2,6],[1,7],[6,4],[7,0],[0,5]]");
+    auto const expectedPrerequisites = vector<pair<int, int>>{{1,0},{2,6},{1,7},{6,4},{7,0},{0,5}};
+    CHECK(expectedPrerequisites == prerequisites);
+    auto const path = (filesystem::temp_directory_path() / "course_schedule_case_91.bin").string();
+    writePrerequisiteFile(path, numCourses, prerequisites, true);
+    auto const expected = true;
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const file = MappedPrerequisiteFile{path};
+        CHECK(numCourses == file.numCourses());
+        CHECK(file.hasCsr());
+        CHECK(expected == Solution2_TopologicalSort{}.canFinish(file.numCourses(), file.edges()));
+        CHECK(expected == Solution2_TopologicalSort{}.canFinish(file.csr()));
+        CHECK(expected == Solution3_IterativeDFS{}.canFinish(file.csr()));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    filesystem::remove(path);
+    cerr << "\n";
+}
+
+TEST_CASE("Case 92")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto const prerequisites = parsePrerequisiteText(" [ [1, 0],\n  [0, 1] ] ");
+    auto const path = (filesystem::temp_directory_path() / "course_schedule_case_92.bin").string();
+    writePrerequisiteFile(path, numCourses, prerequisites, false);
+    auto const expected = false;
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const file = MappedPrerequisiteFile{path};
+        CHECK_FALSE(file.hasCsr());
+        CHECK(expected == Solution1_DFS{}.canFinish(file.numCourses(), file.edges()));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    filesystem::remove(path);
+    cerr << "\n";
+}
+
+TEST_CASE("Case 93")
+{
+    cerr << doctest::testName() << '\n';
+    CHECK(parsePrerequisiteText("[]").empty());
+    CHECK_THROWS_AS(parsePrerequisiteText("[[1,0],[0]]"), invalid_argument);
+    CHECK_THROWS_AS(parsePrerequisiteText("[[1,0]"), invalid_argument);
+    auto const path = (filesystem::temp_directory_path() / "course_schedule_case_93.bin").string();
+    CHECK_THROWS_AS(writePrerequisiteFile(path, 2, vector<pair<int, int>>{{2,0}}, false), invalid_argument);
+    {
+        ofstream{path} << "[[1,0]]";
+    }
+    CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+    filesystem::remove(path);
+    cerr << "\n";
+}
+
+TEST_CASE("Case 94")
+{
+    cerr << doctest::testName() << '\n';
+    // Corrupted payloads are rejected at load time, before any engine indexes with them.
+    auto const path = (filesystem::temp_directory_path() / "course_schedule_case_94.bin").string();
+    auto const prerequisites = vector<pair<int, int>>{{1,0},{2,1},{2,0}};
+    auto const numCourses = 3;
+    auto const edgesOffset = sizeof(prerequisite_file_header_t);
+    auto const offsetsOffset = edgesOffset + 2 * prerequisites.size() * sizeof(int32_t);
+    auto const targetsOffset = offsetsOffset + (numCourses + 1) * sizeof(int32_t);
+    auto const corrupt = [&](size_t byteOffset, int32_t value) {
+        writePrerequisiteFile(path, numCourses, prerequisites, true);
+        fstream file{path, ios::binary | ios::in | ios::out};
+        file.seekp(static_cast<streamoff>(byteOffset));
+        file.write(reinterpret_cast<char const*>(&value), sizeof(value));
+    };
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        writePrerequisiteFile(path, numCourses, prerequisites, true);
+        CHECK(MappedPrerequisiteFile{path}.hasCsr());
+        corrupt(edgesOffset, numCourses);
+        CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+        corrupt(edgesOffset + sizeof(int32_t), -1);
+        CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+        corrupt(offsetsOffset, 1);
+        CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+        corrupt(offsetsOffset + sizeof(int32_t), 3);
+        CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+        corrupt(offsetsOffset + numCourses * sizeof(int32_t), 2);
+        CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+        corrupt(targetsOffset, 7);
+        CHECK_THROWS_AS(MappedPrerequisiteFile{path}, runtime_error);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    filesystem::remove(path);
+    cerr << "\n";
+}
+
+TEST_CASE("Case 101")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0}
+    };
+    auto const expected = true;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 102")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {0,1},
+    };
+    auto const expected = false;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 103")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expected = true;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 104")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 105")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expected = false;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 106")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,0},
+        {0,2}
+    };
+    auto const expected = false;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 107")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expected = false;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 108")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 100;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,0},{2,1},{3,1},{3,2},{4,2},{4,3},{5,3},{5,4},{6,4},{6,5},{7,5},{7,6},{8,6},{8,7},{9,7},{9,8},{10,8},{10,9},{11,9},{11,10},{12,10},{12,11},{13,11},{13,12},{14,12},{14,13},{15,13},{15,14},{16,14},{16,15},{17,15},{17,16},{18,16},{18,17},{19,17},{19,18},{20,18},{20,19},{21,19},{21,20},{22,20},{22,21},{23,21},{23,22},{24,22},{24,23},{25,23},{25,24},{26,24},{26,25},{27,25},{27,26},{28,26},{28,27},{29,27},{29,28},{30,28},{30,29},{31,29},{31,30},{32,30},{32,31},{33,31},{33,32},{34,32},{34,33},{35,33},{35,34},{36,34},{36,35},{37,35},{37,36},{38,36},{38,37},{39,37},{39,38},{40,38},{40,39},{41,39},{41,40},{42,40},{42,41},{43,41},{43,42},{44,42},{44,43},{45,43},{45,44},{46,44},{46,45},{47,45},{47,46},{48,46},{48,47},{49,47},{49,48},{50,48},{50,49},{51,49},{51,50},{52,50},{52,51},{53,51},{53,52},{54,52},{54,53},{55,53},{55,54},{56,54},{56,55},{57,55},{57,56},{58,56},{58,57},{59,57},{59,58},{60,58},{60,59},{61,59},{61,60},{62,60},{62,61},{63,61},{63,62},{64,62},{64,63},{65,63},{65,64},{66,64},{66,65},{67,65},{67,66},{68,66},{68,67},{69,67},{69,68},{70,68},{70,69},{71,69},{71,70},{72,70},{72,71},{73,71},{73,72},{74,72},{74,73},{75,73},{75,74},{76,74},{76,75},{77,75},{77,76},{78,76},{78,77},{79,77},{79,78},{80,78},{80,79},{81,79},{81,80},{82,80},{82,81},{83,81},{83,82},{84,82},{84,83},{85,83},{85,84},{86,84},{86,85},{87,85},{87,86},{88,86},{88,87},{89,87},{89,88},{90,88},{90,89},{91,89},{91,90},{92,90},{92,91},{93,91},{93,92},{94,92},{94,93},{95,93},{95,94},{96,94},{96,95},{97,95},{97,96},{98,96},{98,97},{99,97}
+    };
+    auto const expected = true;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 109")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = vector<pair<int, int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 110")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto const prerequisites = vector<int>{
+        1,0,
+        2,0,
+        0,2
+    };
+    auto const expected = false;
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<int const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 111")
+{
+    cerr << doctest::testName() << '\n';
+    // Two independent cycles, a course depending on both, and a self-loop: all reported by one pass.
+    auto const numCourses = 7;
+    auto prerequisites = vector<vector<int>>{
+        {0,1},{1,0},
+        {2,3},{3,4},{4,2},
+        {5,0},{5,2},
+        {6,6}
+    };
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto components = solution.diagnose(numCourses, prerequisites);
+        auto const memberSets = [&] {
+            auto result = vector<vector<int>>{};
+            for (int component = 0; components.members.nodeCount() > component; ++component) {
+                auto const members = components.members.neighbors(component);
+                result.emplace_back(members.begin(), members.end());
+                sort(result.back().begin(), result.back().end());
+            }
+            return result;
+        }();
+        CHECK(memberSets == vector<vector<int>>{{0,1},{2,3,4},{5},{6}});
+        CHECK(components.componentOf == vector<int>{0,0,1,1,1,2,3});
+        CHECK(components.cyclicComponents == vector<int>{0,1,3});
+        CHECK(ranges::equal(components.condensation.offsets, vector<int>{0,0,0,2,2}));
+        CHECK(ranges::equal(components.condensation.targets, vector<int>{0,1}));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 112")
+{
+    cerr << doctest::testName() << '\n';
+    // A 10^6 course chain closed into one cycle: one component, no call stack recursion.
+    auto const numCourses = 1'000'000;
+    auto prerequisites = vector<pair<int, int>>{};
+    prerequisites.reserve(numCourses);
+    for (int course = 1; numCourses > course; ++course) {
+        prerequisites.emplace_back(course, course - 1);
+    }
+    prerequisites.emplace_back(0, numCourses - 1);
+    auto solution = Solution5_TarjanSCC{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const courses = makeCsrGraph(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(false == solution.canFinish(courses));
+        auto const components = solution.diagnose(courses);
+        CHECK(1 == components.members.nodeCount());
+        CHECK(components.cyclicComponents == vector<int>{0});
+        CHECK(0 == components.condensation.edgeCount());
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 121")
+{
+    cerr << doctest::testName() << '\n';
+    // Base chain 3 -> 2 -> 1 -> 0; overlays either follow the chain or close a cycle.
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,1},{3,2}
+    };
+    auto const queries = vector<vector<pair<int, int>>>{
+        {},
+        {{3,0},{4,3}},
+        {{0,3}},
+        {{0,4},{4,2}},
+        {{4,4}},
+        {{0,4}},
+    };
+    auto const expected = vector<bool>{true, true, false, false, false, true};
+    auto batch = BatchCourseSchedule{numCourses, prerequisites, 2};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(batch.baseCanFinish());
+        CHECK(expected == batch.canFinish(span<vector<pair<int, int>> const>{queries}));
+        for (size_t queryIdx = 0; queries.size() > queryIdx; ++queryIdx) {
+            CHECK(expected[queryIdx] == batch.canFinish(BatchCourseSchedule::query_t{queries[queryIdx]}));
+        }
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 122")
+{
+    cerr << doctest::testName() << '\n';
+    // A cyclic base catalog makes every query false.
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{0,1}
+    };
+    auto const queries = vector<vector<pair<int, int>>>{{}, {{2,0}}};
+    auto batch = BatchCourseSchedule{numCourses, prerequisites};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(false == batch.baseCanFinish());
+        CHECK(vector<bool>{false, false} == batch.canFinish(span<vector<pair<int, int>> const>{queries}));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 123")
+{
+    cerr << doctest::testName() << '\n';
+    // Random overlays on a random acyclic base must agree with a from-scratch topological sort.
+    auto const numCourses = 300;
+    auto random = mt19937{123};
+    auto pick = uniform_int_distribution<int>{0, numCourses - 1};
+    auto base = vector<pair<int, int>>{};
+    for (int prerequisiteIdx = 0; 600 > prerequisiteIdx; ++prerequisiteIdx) {
+        auto const first = pick(random);
+        auto const second = pick(random);
+        auto const [low, high] = minmax(first, second);
+        if (low != high) { base.emplace_back(high, low); }
+    }
+    auto queries = vector<vector<pair<int, int>>>(2000);
+    for (auto& query : queries) {
+        for (auto count = pick(random) % 4; 0 <= count; --count) {
+            query.emplace_back(pick(random), pick(random));
+        }
+    }
+    auto batch = BatchCourseSchedule{numCourses, span<pair<int, int> const>{base}, 4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const results = batch.canFinish(span<vector<pair<int, int>> const>{queries});
+        auto falseCount = 0;
+        for (size_t queryIdx = 0; queries.size() > queryIdx; ++queryIdx) {
+            auto prerequisites = base;
+            prerequisites.insert(prerequisites.end(), queries[queryIdx].begin(), queries[queryIdx].end());
+            auto const expected = Solution2_TopologicalSort{}.canFinish(
+                numCourses
+                , span<pair<int, int> const>{prerequisites}
+            );
+            CHECK(expected == results[queryIdx]);
+            falseCount += expected ? 0 : 1;
+        }
+        CHECK(0 < falseCount);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 124")
+{
+    cerr << doctest::testName() << '\n';
+    // Single queries from several threads on one shared (const) object agree with the batch answers.
+    auto const numCourses = 300;
+    auto random = mt19937{124};
+    auto pick = uniform_int_distribution<int>{0, numCourses - 1};
+    auto base = vector<pair<int, int>>{};
+    for (int prerequisiteIdx = 0; 600 > prerequisiteIdx; ++prerequisiteIdx) {
+        auto const first = pick(random);
+        auto const second = pick(random);
+        auto const [low, high] = minmax(first, second);
+        if (low != high) { base.emplace_back(high, low); }
+    }
+    auto queries = vector<vector<pair<int, int>>>(2000);
+    for (auto& query : queries) {
+        for (auto count = pick(random) % 4; 0 <= count; --count) {
+            query.emplace_back(pick(random), pick(random));
+        }
+    }
+    auto batch = BatchCourseSchedule{numCourses, span<pair<int, int> const>{base}, 4};
+    auto const expected = batch.canFinish(span<vector<pair<int, int>> const>{queries});
+    auto const& shared = batch;
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const threadCount = 4u;
+        vector<uint8_t> results(queries.size(), false);
+        {
+            vector<jthread> threads{};
+            for (unsigned threadIdx = 0; threadCount > threadIdx; ++threadIdx) {
+                threads.emplace_back([&, threadIdx] {
+                    for (auto queryIdx = size_t{threadIdx}; queries.size() > queryIdx; queryIdx += threadCount) {
+                        results[queryIdx] = shared.canFinish(BatchCourseSchedule::query_t{queries[queryIdx]});
+                    }
+                });
+            }
+        } // Join.
+        CHECK(expected == vector<bool>(results.begin(), results.end()));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 131")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0}
+    };
+    auto const expected = true;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 132")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {0,1},
+    };
+    auto const expected = false;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 133")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expected = true;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 134")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 135")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expected = false;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 136")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,0},
+        {0,2}
+    };
+    auto const expected = false;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 137")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expected = false;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 138")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 100;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,0},{2,1},{3,1},{3,2},{4,2},{4,3},{5,3},{5,4},{6,4},{6,5},{7,5},{7,6},{8,6},{8,7},{9,7},{9,8},{10,8},{10,9},{11,9},{11,10},{12,10},{12,11},{13,11},{13,12},{14,12},{14,13},{15,13},{15,14},{16,14},{16,15},{17,15},{17,16},{18,16},{18,17},{19,17},{19,18},{20,18},{20,19},{21,19},{21,20},{22,20},{22,21},{23,21},{23,22},{24,22},{24,23},{25,23},{25,24},{26,24},{26,25},{27,25},{27,26},{28,26},{28,27},{29,27},{29,28},{30,28},{30,29},{31,29},{31,30},{32,30},{32,31},{33,31},{33,32},{34,32},{34,33},{35,33},{35,34},{36,34},{36,35},{37,35},{37,36},{38,36},{38,37},{39,37},{39,38},{40,38},{40,39},{41,39},{41,40},{42,40},{42,41},{43,41},{43,42},{44,42},{44,43},{45,43},{45,44},{46,44},{46,45},{47,45},{47,46},{48,46},{48,47},{49,47},{49,48},{50,48},{50,49},{51,49},{51,50},{52,50},{52,51},{53,51},{53,52},{54,52},{54,53},{55,53},{55,54},{56,54},{56,55},{57,55},{57,56},{58,56},{58,57},{59,57},{59,58},{60,58},{60,59},{61,59},{61,60},{62,60},{62,61},{63,61},{63,62},{64,62},{64,63},{65,63},{65,64},{66,64},{66,65},{67,65},{67,66},{68,66},{68,67},{69,67},{69,68},{70,68},{70,69},{71,69},{71,70},{72,70},{72,71},{73,71},{73,72},{74,72},{74,73},{75,73},{75,74},{76,74},{76,75},{77,75},{77,76},{78,76},{78,77},{79,77},{79,78},{80,78},{80,79},{81,79},{81,80},{82,80},{82,81},{83,81},{83,82},{84,82},{84,83},{85,83},{85,84},{86,84},{86,85},{87,85},{87,86},{88,86},{88,87},{89,87},{89,88},{90,88},{90,89},{91,89},{91,90},{92,90},{92,91},{93,91},{93,92},{94,92},{94,93},{95,93},{95,94},{96,94},{96,95},{97,95},{97,96},{98,96},{98,97},{99,97}
+    };
+    auto const expected = true;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 139")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = vector<pair<int, int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 140")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto const prerequisites = vector<int>{
+        1,0,
+        2,0,
+        0,2
+    };
+    auto const expected = false;
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<int const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 141")
+{
+    cerr << doctest::testName() << '\n';
+    // Transitive prerequisite queries must match a DFS from each course.
+    auto const numCourses = 130;
+    auto random = mt19937{141};
+    auto pick = uniform_int_distribution<int>{0, numCourses - 1};
+    auto prerequisites = vector<vector<int>>{};
+    for (int prerequisiteIdx = 0; 400 > prerequisiteIdx; ++prerequisiteIdx) {
+        auto const first = pick(random);
+        auto const second = pick(random);
+        auto const [low, high] = minmax(first, second);
+        if (low != high) { prerequisites.push_back({high, low}); }
+    }
+    auto solution = Solution6_BitsetReachability{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        REQUIRE(solution.canFinish(numCourses, prerequisites));
+        auto const courses = makeCsrGraph(numCourses, prerequisites);
+        for (int course = 0; numCourses > course; ++course) {
+            auto reached = vector<bool>(numCourses, false);
+            auto stack = vector<int>{course};
+            while (!stack.empty()) {
+                auto const next = stack.back();
+                stack.pop_back();
+                for (auto const prerequisite : courses.neighbors(next)) {
+                    if (!reached[static_cast<size_t>(prerequisite)]) {
+                        reached[static_cast<size_t>(prerequisite)] = true;
+                        stack.push_back(prerequisite);
+                    }
+                }
+            }
+            for (int prerequisite = 0; numCourses > prerequisite; ++prerequisite) {
+                CHECK(reached[static_cast<size_t>(prerequisite)] == solution.isPrerequisite(prerequisite, course));
+            }
+        }
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 151")
+{
+    cerr << doctest::testName() << '\n';
+    // Case 5 with sparse 64 bit course ids: only the 13 courses that appear in an edge are kept.
+    auto const idBase = int64_t{9'000'000'000'000};
+    auto prerequisites = vector<pair<int64_t, int64_t>>{};
+    for (auto const& [course, prerequisite] : vector<pair<int, int>>{
+        {0,10},{3,18},{5,5},{6,11},{11,14},{13,1},{15,1},{17,4}
+    }) {
+        prerequisites.emplace_back(idBase + 7919 * course, idBase + 7919 * prerequisite);
+    }
+    auto const expected = false;
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const catalog = compactCatalog(prerequisites);
+        CHECK(13 == catalog.ids.size());
+        CHECK(13 == catalog.graph.nodeCount());
+        CHECK(expected == Solution2_TopologicalSort{}.canFinish(catalog.graph));
+        CHECK(expected == Solution3_IterativeDFS{}.canFinish(catalog.graph));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 152")
+{
+    cerr << doctest::testName() << '\n';
+    // An order over compact courses maps back to a valid order of the original ids.
+    auto const prerequisites = vector<pair<int64_t, int64_t>>{
+        {-5, 1'000'000'000'000}, {42, -5}, {42, 1'000'000'000'000}, {7, 42}
+    };
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto catalog = compactCatalog(prerequisites);
+        CHECK(vector<int64_t>{-5, 1'000'000'000'000, 42, 7} == catalog.ids);
+        auto workspace = Solution2_TopologicalSort::Workspace{};
+        auto const order = Solution2_TopologicalSort{}.findOrder(catalog.graph, workspace);
+        REQUIRE(4 == order.size());
+        auto positions = unordered_map<int64_t, size_t>{};
+        for (size_t position = 0; order.size() > position; ++position) {
+            positions[catalog.ids[static_cast<size_t>(order[position])]] = position;
+        }
+        for (auto const& [course, prerequisite] : prerequisites) {
+            CHECK(positions[prerequisite] < positions[course]);
+        }
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 161")
+{
+    cerr << doctest::testName() << '\n';
+    // Case 5: the self-loop {5,5} is the third prerequisite; nothing after it is read.
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expected = false;
+    auto solution = Prechecked<Solution2_TopologicalSort>{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        CHECK(solution.stats().shortCircuited);
+        CHECK(3 == solution.stats().streamedEdges);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 162")
+{
+    cerr << doctest::testName() << '\n';
+    // Case 2: the reversed pair is caught by the edge set.
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {0,1},
+    };
+    auto const expected = false;
+    auto solution = Prechecked<Solution3_IterativeDFS>{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        CHECK(solution.stats().shortCircuited);
+        CHECK(2 == solution.stats().streamedEdges);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 163")
+{
+    cerr << doctest::testName() << '\n';
+    // A star of courses requiring course 0 trims away entirely; the engine never runs.
+    auto const numCourses = 6;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,0},{3,0},{4,0}
+    };
+    auto const expected = true;
+    auto solution = Prechecked<Solution2_TopologicalSort>{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        CHECK(false == solution.stats().shortCircuited);
+        CHECK(6 == solution.stats().trimmedCourses);
+        CHECK(4 == solution.stats().trimmedEdges);
+        CHECK(0 == solution.stats().residualEdges);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 164")
+{
+    cerr << doctest::testName() << '\n';
+    // A 3 cycle with a tail on either side: only the cycle reaches the engine.
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {0,1},{1,2},{2,3},{3,1},{3,4}
+    };
+    auto const expected = false;
+    auto solution = Prechecked<Solution2_TopologicalSort>{};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        CHECK(5 == solution.stats().streamedEdges);
+        CHECK(2 == solution.stats().trimmedCourses);
+        CHECK(3 == solution.stats().residualCourses);
+        CHECK(3 == solution.stats().residualEdges);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 171")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0}
+    };
+    auto const expected = true;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 172")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 2;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {0,1},
+    };
+    auto const expected = false;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 173")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 5;
+    auto prerequisites = vector<vector<int>>{
+        {1,4},
+        {2,4},
+        {3,1},
+        {3,2}
+    };
+    auto const expected = true;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 174")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 175")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 20;
+    auto prerequisites = vector<vector<int>>{
+        {0,10},
+        {3,18},
+        {5,5},
+        {6,11},
+        {11,14},
+        {13,1},
+        {15,1},
+        {17,4}
+    };
+    auto const expected = false;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 176")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {2,0},
+        {0,2}
+    };
+    auto const expected = false;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 177")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},
+        {1,2},
+        {0,1}
+    };
+    auto const expected = false;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 178")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 100;
+    auto prerequisites = vector<vector<int>>{
+        {1,0},{2,0},{2,1},{3,1},{3,2},{4,2},{4,3},{5,3},{5,4},{6,4},{6,5},{7,5},{7,6},{8,6},{8,7},{9,7},{9,8},{10,8},{10,9},{11,9},{11,10},{12,10},{12,11},{13,11},{13,12},{14,12},{14,13},{15,13},{15,14},{16,14},{16,15},{17,15},{17,16},{18,16},{18,17},{19,17},{19,18},{20,18},{20,19},{21,19},{21,20},{22,20},{22,21},{23,21},{23,22},{24,22},{24,23},{25,23},{25,24},{26,24},{26,25},{27,25},{27,26},{28,26},{28,27},{29,27},{29,28},{30,28},{30,29},{31,29},{31,30},{32,30},{32,31},{33,31},{33,32},{34,32},{34,33},{35,33},{35,34},{36,34},{36,35},{37,35},{37,36},{38,36},{38,37},{39,37},{39,38},{40,38},{40,39},{41,39},{41,40},{42,40},{42,41},{43,41},{43,42},{44,42},{44,43},{45,43},{45,44},{46,44},{46,45},{47,45},{47,46},{48,46},{48,47},{49,47},{49,48},{50,48},{50,49},{51,49},{51,50},{52,50},{52,51},{53,51},{53,52},{54,52},{54,53},{55,53},{55,54},{56,54},{56,55},{57,55},{57,56},{58,56},{58,57},{59,57},{59,58},{60,58},{60,59},{61,59},{61,60},{62,60},{62,61},{63,61},{63,62},{64,62},{64,63},{65,63},{65,64},{66,64},{66,65},{67,65},{67,66},{68,66},{68,67},{69,67},{69,68},{70,68},{70,69},{71,69},{71,70},{72,70},{72,71},{73,71},{73,72},{74,72},{74,73},{75,73},{75,74},{76,74},{76,75},{77,75},{77,76},{78,76},{78,77},{79,77},{79,78},{80,78},{80,79},{81,79},{81,80},{82,80},{82,81},{83,81},{83,82},{84,82},{84,83},{85,83},{85,84},{86,84},{86,85},{87,85},{87,86},{88,86},{88,87},{89,87},{89,88},{90,88},{90,89},{91,89},{91,90},{92,90},{92,91},{93,91},{93,92},{94,92},{94,93},{95,93},{95,94},{96,94},{96,95},{97,95},{97,96},{98,96},{98,97},{99,97}
+    };
+    auto const expected = true;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, prerequisites);
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 179")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 8;
+    auto const prerequisites = vector<pair<int, int>>{
+        {1,0},
+        {2,6},
+        {1,7},
+        {6,4},
+        {7,0},
+        {0,5}
+    };
+    auto const expected = true;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 180")
+{
+    cerr << doctest::testName() << '\n';
+    auto const numCourses = 3;
+    auto const prerequisites = vector<int>{
+        1,0,
+        2,0,
+        0,2
+    };
+    auto const expected = false;
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const result = solution.canFinish(numCourses, span<int const>{prerequisites});
+        CHECK(expected == result);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 181")
+{
+    cerr << doctest::testName() << '\n';
+    // 2000 independent departments, each a 500 course chain; then close a cycle in the last one.
+    auto const departmentCount = 2000;
+    auto const departmentSize = 500;
+    auto const numCourses = departmentCount * departmentSize;
+    auto prerequisites = vector<pair<int, int>>{};
+    for (int department = 0; departmentCount > department; ++department) {
+        auto const first = department * departmentSize;
+        for (int course = first + 1; first + departmentSize > course; ++course) {
+            prerequisites.emplace_back(course, course - 1);
+        }
+    }
+    auto solution = Solution7_ParallelDFS{4};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(true == solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites}));
+        prerequisites.emplace_back(numCourses - departmentSize, numCourses - 1);
+        CHECK(false == solution.canFinish(numCourses, span<pair<int, int> const>{prerequisites}));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 191")
+{
+    cerr << doctest::testName() << '\n';
+    // Positional level order: the children of slot i are slots 2i + 1 and 2i + 2.
+    auto const positional = vector<int>{3,9,20,null,null,15,7,null,null,null,null,30,40};
+    auto const compact = vector<int>{3,9,20,null,null,15,7,30,40};
+    auto const expectedPreorder = vector<int>{3,9,20,15,30,40,7};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const root = createLevelOrderBT(positional);
+        CHECK(expectedPreorder == preorder(root.get()));
+        CHECK(positional == btToLevelOrder(root.get()));
+        CHECK(compact == btToCompactLevelOrder(root.get()));
+        tree_node_pool_t pool{};
+        auto const pooledRoot = createLevelOrderBT(positional, pool);
+        CHECK(expectedPreorder == preorder(pooledRoot));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        // Feeding one format to the other's parser is rejected, not silently misread.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK_THROWS_AS(createCompactLevelOrderBT(positional), invalid_argument);
+        CHECK_THROWS_AS(createLevelOrderBT(compact), invalid_argument);
+        tree_node_pool_t pool{};
+        CHECK_THROWS_AS(createCompactLevelOrderBT(positional, pool), invalid_argument);
+        CHECK_THROWS_AS(createLevelOrderBT(compact, pool), invalid_argument);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(nullptr == createLevelOrderBT(vector<int>{}));
+        CHECK(nullptr == createLevelOrderBT(vector<int>{null}));
+        CHECK(nullptr == createCompactLevelOrderBT(vector<int>{}));
+        CHECK(nullptr == createCompactLevelOrderBT(vector<int>{null}));
+        CHECK(btToLevelOrder(nullptr).empty());
+        CHECK(btToCompactLevelOrder(nullptr).empty());
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 192")
+{
+    cerr << doctest::testName() << '\n';
+    // Compact leetcode level order: only the children of real nodes are listed.
+    auto const compact = vector<int>{5,4,8,11,null,13,4,7,2,null,null,null,1};
+    auto const expectedPreorder = vector<int>{5,4,11,7,2,8,13,4,1};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const root = createCompactLevelOrderBT(compact);
+        CHECK(expectedPreorder == preorder(root.get()));
+        CHECK(compact == btToCompactLevelOrder(root.get()));
+        CHECK(root->val == createLevelOrderBT(btToLevelOrder(root.get()))->val);
+        CHECK(expectedPreorder == preorder(createLevelOrderBT(btToLevelOrder(root.get())).get()));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+
+    // Right chains: the compact form is one value and one null per node; the positional one is 2^depth slots.
+    auto const chain = [](int nodeCount, tree_node_pool_t& pool) {
+        TreeNode* root = nullptr;
+        auto link = &root;
+        for (int value = 0; nodeCount > value; ++value) {
+            *link = pool.make(value);
+            link = &(*link)->right;
+        }
+        return root;
+    };
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const nodeCount = 100'000;
+        tree_node_pool_t pool{static_cast<size_t>(nodeCount)};
+        auto const root = chain(nodeCount, pool);
+        auto const levelOrderNodes = btToCompactLevelOrder(root);
+        CHECK(2 * static_cast<size_t>(nodeCount) - 1 == levelOrderNodes.size());
+        tree_node_pool_t parsedPool{static_cast<size_t>(nodeCount)};
+        auto const parsed = createCompactLevelOrderBT(levelOrderNodes, parsedPool);
+        CHECK(inorder(root) == inorder(parsed));
+        CHECK(levelOrderNodes == btToCompactLevelOrder(parsed));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        tree_node_pool_t pool{};
+        auto const root = chain(16, pool);
+        auto const levelOrderNodes = btToLevelOrder(root);
+        CHECK((size_t{1} << 16) - 1 == levelOrderNodes.size());
+        auto const parsed = createLevelOrderBT(levelOrderNodes, pool);
+        CHECK(inorder(root) == inorder(parsed));
+        // Past 63 levels a 64 bit slot index can not address the nodes.
+        CHECK_THROWS_AS(btToLevelOrder(chain(70, pool)), length_error);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 201")
+{
+    cerr << doctest::testName() << '\n';
+    //           5
+    //       3       8
+    //     1   4   7   9
+    //      2     6
+    auto const values = vector<int>{5,3,8,1,4,7,9,2,6};
+    auto const root = unique_ptr<TreeNode>{createBst(values)};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(vector<int>{1,2,3,4,5,6,7,8,9} == inorder(root.get()));
+        CHECK(vector<int>{5,3,1,2,4,8,7,6,9} == preorder(root.get()));
+        CHECK(vector<int>{2,1,4,3,6,7,9,8,5} == postorder(root.get()));
+        CHECK(vector<int>{5,3,8,1,4,7,9,2,6} == levelorder(root.get()));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        CHECK(inorder(nullptr).empty());
+        CHECK(preorder(nullptr).empty());
+        CHECK(postorder(nullptr).empty());
+        CHECK(levelorder(nullptr).empty());
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 202")
+{
+    cerr << doctest::testName() << '\n';
+    // Write into a preallocated buffer through a raw pointer iterator.
+    auto const root = unique_ptr<TreeNode>{createBst({5,3,8,1,4,7,9,2,6})};
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        array<int, 9> buffer{};
+        CHECK(buffer.data() + buffer.size() == inorder(root.get(), buffer.data()));
+        CHECK(array<int, 9>{1,2,3,4,5,6,7,8,9} == buffer);
+        CHECK(buffer.data() + buffer.size() == postorder(root.get(), buffer.data()));
+        CHECK(array<int, 9>{2,1,4,3,6,7,9,8,5} == buffer);
+        // Traversals append: two in a row fill consecutive ranges.
+        array<int, 18> twice{};
+        auto const middle = preorder(root.get(), twice.data());
+        CHECK(twice.data() + 9 == middle);
+        CHECK(twice.data() + twice.size() == levelorder(root.get(), middle));
+        CHECK(array<int, 18>{5,3,1,2,4,8,7,6,9, 5,3,8,1,4,7,9,2,6} == twice);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 203")
+{
+    cerr << doctest::testName() << '\n';
+    // createBst() on sorted input is a 10^6 deep right chain; no traversal may recurse.
+    auto values = vector<int>(1'000'000);
+    iota(values.begin(), values.end(), 0);
+    tree_node_pool_t pool{values.size()};
+    auto const root = createBst(values, pool);
+    auto reversed = values;
+    reverse(reversed.begin(), reversed.end());
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto buffer = vector<int>(values.size());
+        CHECK(buffer.data() + buffer.size() == inorder(root, buffer.data()));
+        CHECK(values == buffer);
+        CHECK(values == preorder(root));
+        CHECK(reversed == postorder(root));
+        CHECK(values == levelorder(root));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 211")
+{
+    cerr << doctest::testName() << '\n';
+    // Deleting 10^6 node chains, leaning either way, must not recurse.
+    auto values = vector<int>(1'000'000);
+    iota(values.begin(), values.end(), 0);
+    auto rightChain = unique_ptr<TreeNode>{createBst(values)};
+    reverse(values.begin(), values.end());
+    auto leftChain = unique_ptr<TreeNode>{createBst(values)};
+    CHECK(nullptr == rightChain->left);
+    CHECK(nullptr == leftChain->right);
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        rightChain.reset();
+        leftChain.reset();
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        // Zigzag: every node has one child on alternating sides.
+        auto const start = std::chrono::steady_clock::now();
+        auto zigzag = unique_ptr<TreeNode>{new TreeNode{0}};
+        auto node = zigzag.get();
+        for (int depth = 1; 1'000'000 > depth; ++depth) {
+            node = (0 == depth % 2 ? node->left : node->right) = new TreeNode{depth};
+        }
+        zigzag.reset();
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 212")
+{
+    cerr << doctest::testName() << '\n';
+    // Pooled trees have the same shape as heap trees, in one contiguous block.
+    auto values = vector<int>(10'000);
+    iota(values.begin(), values.end(), 0);
+    shuffle(values.begin(), values.end(), mt19937{212});
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const heapRoot = unique_ptr<TreeNode>{createBst(values)};
+        tree_node_pool_t pool{values.size()};
+        auto const pooledRoot = createBst(values, pool);
+        CHECK(preorder(heapRoot.get()) == preorder(pooledRoot));
+        CHECK(levelorder(heapRoot.get()) == levelorder(pooledRoot));
+        CHECK(values.size() == pool.size());
+
+        auto addresses = vector<uintptr_t>{};
+        auto pending = vector<TreeNode const*>{pooledRoot};
+        while (!pending.empty()) {
+            auto const node = pending.back();
+            pending.pop_back();
+            addresses.push_back(reinterpret_cast<uintptr_t>(node));
+            if (node->left) { pending.push_back(node->left); }
+            if (node->right) { pending.push_back(node->right); }
+        }
+        auto const [lowest, highest] = minmax_element(addresses.begin(), addresses.end());
+        CHECK((values.size() - 1) * sizeof(TreeNode) == *highest - *lowest);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const levelOrderNodes = vector<int>{3,9,20,null,null,15,7,null,null,null,null,30,40};
+        auto const heapRoot = createLevelOrderBT(levelOrderNodes);
+        tree_node_pool_t pool{};
+        auto const pooledRoot = createLevelOrderBT(levelOrderNodes, pool);
+        CHECK(preorder(heapRoot.get()) == preorder(pooledRoot));
+        CHECK(levelOrderNodes == btToLevelOrder(pooledRoot));
+        CHECK(7 == pool.size());
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 213")
+{
+    cerr << doctest::testName() << '\n';
+    // Releasing a pool hands its blocks back upstream; no node is visited or destroyed.
+    struct counting_resource_t : public std::pmr::memory_resource {
+        size_t allocations{};
+        size_t deallocations{};
+
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+    };
+    auto values = vector<int>(1'000'000);
+    iota(values.begin(), values.end(), 0);
+    counting_resource_t upstream{};
+    { // New scope.
+        tree_node_pool_t pool{values.size(), &upstream};
+        auto const root = createBst(values, pool);
+        CHECK(values.size() == pool.size());
+        CHECK(values.back() == postorder(root).front());
+        CHECK(1 == upstream.allocations);
+
+        // Had release() run ~TreeNode, the chain would 'delete' pool memory.
+        auto const start = std::chrono::steady_clock::now();
+        pool.release();
+        CHECK(0 == pool.size());
+        CHECK(1 == upstream.deallocations);
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+
+        // A released pool is reusable.
+        CHECK(vector<int>{1,2,3} == inorder(createBalancedBst({3,1,2}, pool)));
+        CHECK(3 == pool.size());
+    }
+    CHECK(upstream.allocations == upstream.deallocations);
+    cerr << "\n";
+}
+
+TEST_CASE("Case 221")
+{
+    cerr << doctest::testName() << '\n';
+    // Distinct values, in any order, give a height of ceil(log2(n + 1)).
+    auto const heightOf = [](TreeNode const* root) {
+        auto height = 0;
+        for (auto level = root ? vector<TreeNode const*>{root} : vector<TreeNode const*>{}; !level.empty(); ++height) {
+            auto nextLevel = vector<TreeNode const*>{};
+            for (auto const node : level) {
+                if (node->left) { nextLevel.push_back(node->left); }
+                if (node->right) { nextLevel.push_back(node->right); }
+            }
+            level = move(nextLevel);
+        }
+        return height;
+    };
+    auto random = mt19937{221};
+    for (auto const nodeCount : {0, 1, 2, 3, 7, 8, 1000, 1 << 16}) {
+        auto values = vector<int>(static_cast<size_t>(nodeCount));
+        iota(values.begin(), values.end(), -nodeCount / 2);
+        auto const sorted = values;
+        shuffle(values.begin(), values.end(), random);
+        auto const expectedHeight = static_cast<int>(ceil(log2(nodeCount + 1.0)));
+        { // New scope.
+            auto const start = std::chrono::steady_clock::now();
+            tree_node_pool_t pool{values.size()};
+            auto const root = createBalancedBst(values, pool);
+            CHECK(sorted == inorder(root));
+            CHECK(expectedHeight == heightOf(root));
+            CHECK(values.size() == pool.size());
+            cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+        }
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 222")
+{
+    cerr << doctest::testName() << '\n';
+    // Already sorted input takes the no-sort path and builds the same tree as shuffled input.
+    auto sorted = vector<int>(100'000);
+    iota(sorted.begin(), sorted.end(), 0);
+    auto shuffled = sorted;
+    shuffle(shuffled.begin(), shuffled.end(), mt19937{222});
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        tree_node_pool_t sortedPool{sorted.size()};
+        auto const fromSorted = createSortedBalancedBst(sorted, sortedPool);
+        tree_node_pool_t shuffledPool{shuffled.size()};
+        auto const fromShuffled = createBalancedBst(shuffled, shuffledPool);
+        auto const fromHeap = unique_ptr<TreeNode>{createBalancedBst(sorted)};
+        CHECK(preorder(fromShuffled) == preorder(fromSorted));
+        CHECK(preorder(fromHeap.get()) == preorder(fromSorted));
+        CHECK(sorted == inorder(fromSorted));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
+TEST_CASE("Case 223")
+{
+    cerr << doctest::testName() << '\n';
+    // Duplicates go right, as in createBst(): value < node->val left, anything else right.
+    auto const values = vector<int>{3,2,1,3,2,2};
+    auto const expectedPreorder = vector<int>{2,1,3,2,2,3};
+    auto const followsBstRule = [](TreeNode const* root) {
+        // Every node must satisfy lower <= val < upper for the bounds set by its ancestors.
+        auto pending = vector<tuple<TreeNode const*, long long, long long>>{{root, LLONG_MIN, LLONG_MAX}};
+        while (!pending.empty()) {
+            auto const [node, lower, upper] = pending.back();
+            pending.pop_back();
+            if (!node) { continue; }
+            if (node->val < lower || node->val >= upper) { return false; }
+            pending.emplace_back(node->left, lower, node->val);
+            pending.emplace_back(node->right, node->val, upper);
+        }
+        return true;
+    };
+    { // New scope.
+        auto const start = std::chrono::steady_clock::now();
+        auto const heapRoot = unique_ptr<TreeNode>{createBalancedBst(values)};
+        tree_node_pool_t pool{values.size()};
+        auto const pooledRoot = createBalancedBst(values, pool);
+        auto const insertedRoot = unique_ptr<TreeNode>{createBst(values)};
+        CHECK(expectedPreorder == preorder(heapRoot.get()));
+        CHECK(expectedPreorder == preorder(pooledRoot));
+        CHECK(followsBstRule(heapRoot.get()));
+        CHECK(followsBstRule(pooledRoot));
+        CHECK(followsBstRule(insertedRoot.get()));
+        CHECK(inorder(insertedRoot.get()) == inorder(pooledRoot));
+        cerr << "Elapsed time: " << elapsed_time_t{start} << '\n';
+    }
+    cerr << "\n";
+}
+
 /*
     End of "main.cpp"
 */
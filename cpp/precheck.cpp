@@ -0,0 +1,164 @@
+/*!
+    \file "precheck.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Cheap pre-pass over a prerequisite catalog that runs before a course schedule engine.
+*/
+
+#include "precheck.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace {
+
+/*!
+    \brief Insert-only open addressing (linear probing) set of directed edges.
+
+    An edge is packed into one 64 bit key; course ids are never negative, so
+    the all ones key marks an empty slot.
+*/
+class edge_set_t {
+    static constexpr std::uint64_t emptyKey = ~std::uint64_t{0};
+
+    std::vector<std::uint64_t> slots_{};
+    std::size_t mask_{};
+
+    static std::uint64_t key(int source, int target) noexcept {
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(source)) << 32
+            | static_cast<std::uint32_t>(target);
+    }
+
+    //! splitmix64 finalizer.
+    static std::size_t hash(std::uint64_t bits) noexcept {
+        bits = (bits ^ (bits >> 30)) * 0xBF58476D1CE4E5B9ull;
+        bits = (bits ^ (bits >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::size_t>(bits ^ (bits >> 31));
+    }
+
+public:
+    explicit edge_set_t(std::size_t maxEdgeCount)
+        : slots_(std::bit_ceil((std::max)(std::size_t{2}, 2 * maxEdgeCount)), emptyKey)
+        , mask_{slots_.size() - 1}
+    {}
+
+    bool contains(int source, int target) const noexcept {
+        auto const wanted = key(source, target);
+        for (auto slotIdx = hash(wanted) & mask_; ; slotIdx = (slotIdx + 1) & mask_) {
+            if (wanted == slots_[slotIdx]) { return true; }
+            if (emptyKey == slots_[slotIdx]) { return false; }
+        }
+    }
+
+    void insert(int source, int target) noexcept {
+        auto const wanted = key(source, target);
+        for (auto slotIdx = hash(wanted) & mask_; ; slotIdx = (slotIdx + 1) & mask_) {
+            auto& slot = slots_[slotIdx];
+            if (wanted == slot) { return; }
+            if (emptyKey == slot) {
+                slot = wanted;
+                return;
+            }
+        }
+    }
+};
+
+/*!
+    \brief Pre-pass shared by every edge layout.
+
+    'sourceOf(idx)' and 'targetOf(idx)' return the endpoints of edge 'idx'.
+*/
+template <typename SourceOf, typename TargetOf>
+precheck_t
+precheck(int numCourses, std::size_t edgeCount, SourceOf sourceOf, TargetOf targetOf) {
+    assert(0 <= numCourses);
+    precheck_t result{};
+    auto& stats = result.stats;
+
+    // 1) Trivial cycles, found while streaming.
+    std::vector<int> inDegrees(static_cast<std::size_t>(numCourses), 0);
+    std::vector<int> outDegrees(static_cast<std::size_t>(numCourses), 0);
+    edge_set_t edges{edgeCount};
+    for (std::size_t edgeIdx = 0; edgeCount > edgeIdx; ++edgeIdx) {
+        auto const source = sourceOf(edgeIdx);
+        auto const target = targetOf(edgeIdx);
+        assert(0 <= source && numCourses > source);
+        assert(0 <= target && numCourses > target);
+        ++stats.streamedEdges;
+        if (source == target || edges.contains(target, source)) {
+            stats.shortCircuited = true;
+            result.verdict = precheck_t::verdict_t::cycle;
+            return result;
+        }
+        edges.insert(source, target);
+        ++outDegrees[static_cast<std::size_t>(source)];
+        ++inDegrees[static_cast<std::size_t>(target)];
+    }
+
+    // 2) Trim sources and sinks; renumber the survivors.
+    auto& residualOf = inDegrees;
+    for (std::size_t course = 0; static_cast<std::size_t>(numCourses) > course; ++course) {
+        residualOf[course] = 0 != inDegrees[course] && 0 != outDegrees[course] ? stats.residualCourses++ : -1;
+    }
+    stats.trimmedCourses = numCourses - stats.residualCourses;
+
+    std::vector<std::pair<int, int>> residualEdges{};
+    for (std::size_t edgeIdx = 0; edgeCount > edgeIdx; ++edgeIdx) {
+        auto const source = residualOf[static_cast<std::size_t>(sourceOf(edgeIdx))];
+        auto const target = residualOf[static_cast<std::size_t>(targetOf(edgeIdx))];
+        if (-1 != source && -1 != target) {
+            residualEdges.emplace_back(source, target);
+        }
+    }
+    stats.residualEdges = residualEdges.size();
+    stats.trimmedEdges = edgeCount - residualEdges.size();
+
+    if (residualEdges.empty()) {
+        result.verdict = precheck_t::verdict_t::acyclic;
+        return result;
+    }
+
+    assignCsrGraph(result.residual, stats.residualCourses, std::span<std::pair<int, int> const>{residualEdges});
+    return result;
+}
+
+} // namespace {
+
+precheck_t
+precheckCatalog(int numCourses, std::vector<std::vector<int>> const& prerequisites) {
+    return precheck(
+        numCourses
+        , prerequisites.size()
+        , [&](std::size_t idx) { return prerequisites[idx][0]; }
+        , [&](std::size_t idx) { return prerequisites[idx][1]; }
+    );
+}
+
+precheck_t
+precheckCatalog(int numCourses, std::span<std::pair<int, int> const> prerequisites) {
+    return precheck(
+        numCourses
+        , prerequisites.size()
+        , [&](std::size_t idx) { return prerequisites[idx].first; }
+        , [&](std::size_t idx) { return prerequisites[idx].second; }
+    );
+}
+
+precheck_t
+precheckCatalog(int numCourses, std::span<int const> prerequisites) {
+    assert(0 == prerequisites.size() % 2);
+    return precheck(
+        numCourses
+        , prerequisites.size() / 2
+        , [&](std::size_t idx) { return prerequisites[2 * idx]; }
+        , [&](std::size_t idx) { return prerequisites[2 * idx + 1]; }
+    );
+}
+
+/*
+    End of "precheck.cpp"
+*/
@@ -0,0 +1,79 @@
+/*!
+    \file "precheck.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Cheap pre-pass over a prerequisite catalog that runs before a course schedule engine.
+*/
+
+#ifndef PRECHECK_HPP_2444A690_0EB8_4500_A1DD_A7C563103E04
+#define PRECHECK_HPP_2444A690_0EB8_4500_A1DD_A7C563103E04
+#pragma once
+
+#include "csr_graph.hpp"
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+//! How much work the pre-pass took off the engine.
+struct precheck_stats_t
+{
+    std::size_t streamedEdges{}; //!< Prerequisites read before the verdict (all of them unless short circuited).
+    bool shortCircuited{}; //!< A self-loop or a reversed pair ended the pre-pass early.
+    int trimmedCourses{}; //!< Courses dropped because nothing requires them or they require nothing.
+    std::size_t trimmedEdges{}; //!< Prerequisites dropped with those courses.
+    int residualCourses{}; //!< Courses left for the engine.
+    std::size_t residualEdges{}; //!< Prerequisites left for the engine.
+};
+
+/*!
+    \brief Outcome of precheckCatalog().
+
+    When 'verdict' is undecided, 'residual' holds the courses that survived
+    trimming, renumbered 0 .. residualCourses-1; it has a cycle exactly when
+    the whole catalog does.
+*/
+struct precheck_t
+{
+    enum class verdict_t { cycle, acyclic, undecided };
+
+    verdict_t verdict{verdict_t::undecided};
+    csr_graph_t residual{};
+    precheck_stats_t stats{};
+};
+
+/*!
+    \brief Look for trivial cycles while streaming the prerequisites, then trim what can't be on a cycle.
+
+      1) Stream the prerequisites [ai, bi] through a hashed edge set.  A
+         self-loop (ai == bi) or a prerequisite whose reverse [bi, ai] was
+         already seen is a cycle: stop reading and return verdict_t::cycle.
+      2) A course that requires nothing, or that nothing requires, can't be
+         on a cycle.  Drop those courses and their prerequisites (one round,
+         no cascading).  If no prerequisite survives, return
+         verdict_t::acyclic; otherwise the survivors form the residual graph.
+
+    Time = O(V + E), Space = O(V + E)
+*/
+precheck_t
+precheckCatalog(int numCourses, std::vector<std::vector<int>> const& prerequisites);
+
+//! Zero-copy entry point: 'prerequisites' = [(ai, bi), ...].
+precheck_t
+precheckCatalog(int numCourses, std::span<std::pair<int, int> const> prerequisites);
+
+//! Zero-copy entry point: 'prerequisites' = [a0, b0, a1, b1, ...].
+precheck_t
+precheckCatalog(int numCourses, std::span<int const> prerequisites);
+
+#endif // #ifndef PRECHECK_HPP_2444A690_0EB8_4500_A1DD_A7C563103E04
+
+/*
+    End of "precheck.hpp"
+*/
@@ -0,0 +1,265 @@
+/*!
+    \file "prerequisite_file.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Binary prerequisite files, loaded with mmap so the engines read the edges in place.
+*/
+
+#include "prerequisite_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+
+std::size_t
+edgesSize(prerequisite_file_header_t const& header) noexcept {
+    return 2 * sizeof(std::int32_t) * header.edgeCount;
+}
+
+std::size_t
+csrSize(prerequisite_file_header_t const& header) noexcept {
+    return sizeof(std::int32_t) * (static_cast<std::size_t>(header.numCourses) + 1 + header.edgeCount);
+}
+
+std::byte const*
+payload(prerequisite_file_header_t const* header) noexcept {
+    return reinterpret_cast<std::byte const*>(header) + sizeof(prerequisite_file_header_t);
+}
+
+} // namespace {
+
+MappedPrerequisiteFile::MappedPrerequisiteFile(std::string const& path) {
+    auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (-1 == fd) {
+        throw std::system_error{errno, std::generic_category(), "open " + path};
+    }
+
+    struct stat status{};
+    if (-1 == ::fstat(fd, &status)) {
+        auto const error = errno;
+        ::close(fd);
+        throw std::system_error{error, std::generic_category(), "fstat " + path};
+    }
+
+    mappingSize_ = static_cast<std::size_t>(status.st_size);
+    if (sizeof(prerequisite_file_header_t) > mappingSize_) {
+        ::close(fd);
+        throw std::runtime_error{path + ": too small to be a prerequisite file"};
+    }
+
+    mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+    auto const error = errno;
+    ::close(fd); // The mapping keeps the file alive.
+    if (MAP_FAILED == mapping_) {
+        mapping_ = nullptr;
+        throw std::system_error{error, std::generic_category(), "mmap " + path};
+    }
+
+    // The engines scan the edges front to back.
+    ::madvise(mapping_, mappingSize_, MADV_SEQUENTIAL);
+
+    header_ = static_cast<prerequisite_file_header_t const*>(mapping_);
+    auto const fail = [&](char const* reason) {
+        ::munmap(mapping_, mappingSize_);
+        mapping_ = nullptr;
+        throw std::runtime_error{path + ": " + reason};
+    };
+    if (0 != std::memcmp(header_->magic, prerequisite_file_header_t::expectedMagic, sizeof(header_->magic))) {
+        fail("not a prerequisite file");
+    }
+    if (prerequisite_file_header_t::expectedByteOrder != header_->byteOrder) {
+        fail("written on a host with a different byte order");
+    }
+    if (prerequisite_file_header_t::currentVersion != header_->version) {
+        fail("unsupported prerequisite file version");
+    }
+    if (0 > header_->numCourses
+        || static_cast<std::uint64_t>((std::numeric_limits<int>::max)()) < header_->edgeCount) {
+        fail("course or prerequisite count out of range");
+    }
+    auto const expectedSize = sizeof(prerequisite_file_header_t)
+        + edgesSize(*header_)
+        + (hasCsr() ? csrSize(*header_) : 0);
+    if (expectedSize != mappingSize_) {
+        fail("file size does not match its header");
+    }
+
+    // The engines index their per-course state with every id and offset, so check them all once here.
+    auto const outOfRange = [numCourses = header_->numCourses](int course) {
+        return 0 > course || numCourses <= course;
+    };
+    if (auto const ids = edges(); std::any_of(ids.begin(), ids.end(), outOfRange)) {
+        fail("course id outside [0, numCourses)");
+    }
+    if (hasCsr()) {
+        auto const graph = csr();
+        if (0 != graph.offsets.front()
+            || graph.edgeCount() != graph.offsets.back()
+            || !std::is_sorted(graph.offsets.begin(), graph.offsets.end())) {
+            fail("CSR offsets do not index the CSR targets");
+        }
+        if (std::any_of(graph.targets.begin(), graph.targets.end(), outOfRange)) {
+            fail("CSR target outside [0, numCourses)");
+        }
+    }
+}
+
+MappedPrerequisiteFile::~MappedPrerequisiteFile() {
+    if (mapping_) {
+        ::munmap(mapping_, mappingSize_);
+    }
+}
+
+MappedPrerequisiteFile::MappedPrerequisiteFile(MappedPrerequisiteFile&& other) noexcept
+    : mapping_{std::exchange(other.mapping_, nullptr)}
+    , mappingSize_{std::exchange(other.mappingSize_, 0)}
+    , header_{std::exchange(other.header_, nullptr)}
+{}
+
+MappedPrerequisiteFile&
+MappedPrerequisiteFile::operator=(MappedPrerequisiteFile&& other) noexcept {
+    if (this != &other) {
+        if (mapping_) {
+            ::munmap(mapping_, mappingSize_);
+        }
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mappingSize_ = std::exchange(other.mappingSize_, 0);
+        header_ = std::exchange(other.header_, nullptr);
+    }
+    return *this;
+}
+
+std::span<int const>
+MappedPrerequisiteFile::edges() const noexcept {
+    return {reinterpret_cast<int const*>(payload(header_)), 2 * static_cast<std::size_t>(header_->edgeCount)};
+}
+
+csr_graph_view_t
+MappedPrerequisiteFile::csr() const noexcept {
+    assert(hasCsr());
+    auto const offsets = reinterpret_cast<int const*>(payload(header_) + edgesSize(*header_));
+    auto const offsetCount = static_cast<std::size_t>(header_->numCourses) + 1;
+    return {{offsets, offsetCount}, {offsets + offsetCount, static_cast<std::size_t>(header_->edgeCount)}};
+}
+
+void
+writePrerequisiteFile(
+    std::string const& path
+    , int numCourses
+    , std::span<std::pair<int, int> const> prerequisites
+    , bool withCsr
+) {
+    if (0 > numCourses) {
+        throw std::invalid_argument{"negative course count"};
+    }
+    auto const outOfRange = [&](int course) { return 0 > course || numCourses <= course; };
+    for (auto const& [course, prerequisite] : prerequisites) {
+        if (outOfRange(course) || outOfRange(prerequisite)) {
+            throw std::invalid_argument{"course id outside [0, numCourses)"};
+        }
+    }
+
+    prerequisite_file_header_t header{};
+    std::copy(
+        std::begin(prerequisite_file_header_t::expectedMagic)
+        , std::end(prerequisite_file_header_t::expectedMagic)
+        , header.magic
+    );
+    header.version = prerequisite_file_header_t::currentVersion;
+    header.flags = withCsr ? prerequisite_file_header_t::csrFlag : 0;
+    header.byteOrder = prerequisite_file_header_t::expectedByteOrder;
+    header.numCourses = numCourses;
+    header.edgeCount = prerequisites.size();
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    auto const write = [&](void const* data, std::size_t size) {
+        file.write(static_cast<char const*>(data), static_cast<std::streamsize>(size));
+    };
+    write(&header, sizeof(header));
+    static_assert(sizeof(std::pair<int, int>) == 2 * sizeof(std::int32_t));
+    write(prerequisites.data(), prerequisites.size_bytes());
+    if (withCsr) {
+        auto const graph = makeCsrGraph(numCourses, prerequisites);
+        write(graph.offsets.data(), graph.offsets.size() * sizeof(int));
+        write(graph.targets.data(), graph.targets.size() * sizeof(int));
+    }
+
+    // std::ofstream does not promise to leave errno set, so there is no reliable cause to report.
+    file.close();
+    if (!file) {
+        throw std::runtime_error{"write " + path};
+    }
+}
+
+std::vector<std::pair<int, int>>
+parsePrerequisiteText(std::string_view text) {
+    std::size_t pos = 0;
+    auto const skipSpace = [&] {
+        while (text.size() > pos && std::isspace(static_cast<unsigned char>(text[pos]))) { ++pos; }
+    };
+    auto const expect = [&](char expected) {
+        skipSpace();
+        if (text.size() <= pos || expected != text[pos]) {
+            throw std::invalid_argument{
+                "expected '" + std::string(1, expected) + "' at offset " + std::to_string(pos)
+            };
+        }
+        ++pos;
+    };
+    auto const peek = [&](char expected) {
+        skipSpace();
+        return text.size() > pos && expected == text[pos];
+    };
+    auto const number = [&] {
+        skipSpace();
+        int value{};
+        auto const [end, error] = std::from_chars(text.data() + pos, text.data() + text.size(), value);
+        if (std::errc{} != error) {
+            throw std::invalid_argument{"expected a course id at offset " + std::to_string(pos)};
+        }
+        pos = static_cast<std::size_t>(end - text.data());
+        return value;
+    };
+
+    std::vector<std::pair<int, int>> prerequisites{};
+    expect('[');
+    while (!peek(']')) {
+        if (!prerequisites.empty()) {
+            expect(',');
+        }
+        expect('[');
+        auto const course = number();
+        expect(',');
+        auto const prerequisite = number();
+        expect(']');
+        prerequisites.emplace_back(course, prerequisite);
+    }
+    expect(']');
+
+    skipSpace();
+    if (text.size() != pos) {
+        throw std::invalid_argument{"unexpected text after offset " + std::to_string(pos)};
+    }
+
+    return prerequisites;
+}
+
+/*
+    End of "prerequisite_file.cpp"
+*/
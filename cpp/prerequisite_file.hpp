@@ -0,0 +1,115 @@
+/*!
+    \file "prerequisite_file.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Binary prerequisite files, loaded with mmap so the engines read the edges in place.
+
+    Layout (native byte order, every field 4 byte aligned):
+
+        prerequisite_file_header_t
+        int32 edges[2 * edgeCount]          (course, prerequisite) pairs, i.e. [ai, bi].
+        if (flags & csrFlag):
+            int32 offsets[numCourses + 1]   CSR row offsets (course -> prerequisites).
+            int32 targets[edgeCount]        CSR targets.
+
+    The CSR block, when present, is fed to the engines as a csr_graph_view_t,
+    so loading it costs no graph construction at all.
+*/
+
+#ifndef PREREQUISITE_FILE_HPP_9191B7EE_2EEC_4892_8A2A_0DFA0A591A22
+#define PREREQUISITE_FILE_HPP_9191B7EE_2EEC_4892_8A2A_0DFA0A591A22
+#pragma once
+
+#include "csr_graph.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+struct prerequisite_file_header_t
+{
+    static constexpr char expectedMagic[8] = {'C', 'S', 'C', 'H', 'E', 'D', '\0', '\0'};
+    static constexpr std::uint32_t currentVersion = 1;
+    static constexpr std::uint32_t expectedByteOrder = 0x01020304; //!< Reads differently on a foreign-endian host.
+    static constexpr std::uint32_t csrFlag = 0x1;
+
+    char magic[8]{};
+    std::uint32_t version{};
+    std::uint32_t flags{};
+    std::uint32_t byteOrder{};
+    std::int32_t numCourses{};
+    std::uint64_t edgeCount{};
+};
+static_assert(32 == sizeof(prerequisite_file_header_t));
+
+/*!
+    \brief Read-only memory mapping of a binary prerequisite file.
+
+    Throws std::system_error when the file cannot be opened or mapped and
+    std::runtime_error when it is not a valid prerequisite file.  The whole
+    payload is checked once, while loading: every course id and CSR target
+    must be in [0, numCourses) and the CSR offsets must run from 0 to
+    edgeCount without decreasing, so a truncated or corrupted file is
+    rejected before any engine indexes with it.
+*/
+class MappedPrerequisiteFile {
+    void* mapping_{};
+    std::size_t mappingSize_{};
+    prerequisite_file_header_t const* header_{};
+
+public:
+    explicit MappedPrerequisiteFile(std::string const& path);
+    ~MappedPrerequisiteFile();
+
+    MappedPrerequisiteFile(MappedPrerequisiteFile const&) = delete;
+    MappedPrerequisiteFile& operator=(MappedPrerequisiteFile const&) = delete;
+    MappedPrerequisiteFile(MappedPrerequisiteFile&& other) noexcept;
+    MappedPrerequisiteFile& operator=(MappedPrerequisiteFile&& other) noexcept;
+
+    int numCourses() const noexcept { return header_->numCourses; }
+
+    //! Interleaved [a0, b0, a1, b1, ...], ready for the span<int const> canFinish() overloads.
+    std::span<int const> edges() const noexcept;
+
+    bool hasCsr() const noexcept { return 0 != (header_->flags & prerequisite_file_header_t::csrFlag); }
+
+    //! Prebuilt graph, ready for the csr_graph_view_t canFinish() overloads.  Requires hasCsr().
+    csr_graph_view_t csr() const noexcept;
+};
+
+/*!
+    \brief Write a binary prerequisite file, optionally with a prebuilt CSR block.
+
+    Throws std::invalid_argument when a course id is outside [0, numCourses)
+    and std::runtime_error when the file cannot be written.
+*/
+void
+writePrerequisiteFile(
+    std::string const& path
+    , int numCourses
+    , std::span<std::pair<int, int> const> prerequisites
+    , bool withCsr
+);
+
+/*!
+    \brief Parse leetcode style text, e.g. "[[1,0],[0,1]]", into (ai, bi) pairs.
+
+    Throws std::invalid_argument on malformed text.
+*/
+std::vector<std::pair<int, int>>
+parsePrerequisiteText(std::string_view text);
+
+#endif // #ifndef PREREQUISITE_FILE_HPP_9191B7EE_2EEC_4892_8A2A_0DFA0A591A22
+
+/*
+    End of "prerequisite_file.hpp"
+*/
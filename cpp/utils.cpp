@@ -20,16 +20,30 @@ operator<<(std::ostream& os, elapsed_time_t const& et)
     return os;
 }
 
+namespace {
+
+//! Insert 'values' one by one into a BST of nodes made by 'makeNode(value)'.
+template <typename MakeNode>
 TreeNode*
-createBst(std::vector<int> values) {
+insertBst(std::vector<int> const& values, MakeNode makeNode) {
     TreeNode* root = nullptr;
+    // A value past either end of the tree descends straight down the outer spine, so its parent is
+    // known without the search; this keeps sorted (and reverse sorted) input linear.
+    TreeNode* leftmost = nullptr;
+    TreeNode* rightmost = nullptr;
 
     for (auto value : values) {
         // Search for parent node, if any.
         TreeNode* parent{};
-        for (TreeNode* iter = root; iter; ) {
-            parent = iter;
-            iter = value < iter->val ? iter->left : iter->right;
+        if (rightmost && !(value < rightmost->val)) {
+            parent = rightmost;
+        } else if (leftmost && value < leftmost->val) {
+            parent = leftmost;
+        } else {
+            for (TreeNode* iter = root; iter; ) {
+                parent = iter;
+                iter = value < iter->val ? iter->left : iter->right;
+            }
         }
         
         // Find parent pointer.
@@ -46,55 +60,208 @@ createBst(std::vector<int> values) {
         
         // Allocate new node.
         if (parentPtr) {
-            *parentPtr = new TreeNode{std::move(value)};
+            *parentPtr = makeNode(value);
 
             if (!root) {
                 root = *parentPtr;
             }
+            if (!leftmost || value < leftmost->val) {
+                leftmost = *parentPtr;
+            }
+            if (!rightmost || !(value < rightmost->val)) {
+                rightmost = *parentPtr;
+            }
         }
     }
 
     return root;
 }
 
-std::vector<int>
-inorder(TreeNode const* root) {
-    std::vector<int> result{};
+//! Build a balanced BST of nodes made by 'makeNode(value)' from 'sortedValues'.
+template <typename MakeNode>
+TreeNode*
+buildBalancedBst(std::span<int const> values, MakeNode makeNode) {
+    assert(std::is_sorted(values.begin(), values.end()));
 
-    if (root) {
-        auto const leftResult = inorder(root->left);
-        std::copy(leftResult.begin(), leftResult.end(), std::back_inserter(result));
+    // Each pending range [begin, end) of 'values' becomes the subtree at 'link'.
+    struct range_t {
+        size_t begin{};
+        size_t end{};
+        TreeNode** link{};
+    };
 
-        result.push_back(root->val);
+    TreeNode* root = nullptr;
+    std::vector<range_t> pending{{0, values.size(), &root}};
+    while (!pending.empty()) {
+        auto const range = pending.back();
+        pending.pop_back();
+        if (range.begin == range.end) {
+            continue;
+        }
+
+        // Equal values must go right, so the root is the first of its run.
+        auto const first = values.begin() + static_cast<ptrdiff_t>(range.begin);
+        auto const middle = first + static_cast<ptrdiff_t>((range.end - range.begin) / 2);
+        auto const mid = static_cast<size_t>(std::lower_bound(first, middle, *middle) - values.begin());
 
-        auto const rightResult = inorder(root->right);
-        std::copy(rightResult.begin(), rightResult.end(), std::back_inserter(result));
+        auto const node = makeNode(values[mid]);
+        *range.link = node;
+        pending.push_back({range.begin, mid, &node->left});
+        pending.push_back({mid + 1, range.end, &node->right});
     }
 
+    return root;
+}
+
+} // namespace {
+
+TreeNode*
+createBst(std::vector<int> values) {
+    return insertBst(values, [](int value) { return new TreeNode{value}; });
+}
+
+TreeNode*
+createBst(std::vector<int> const& values, tree_node_pool_t& pool) {
+    return insertBst(values, [&](int value) { return pool.make(value); });
+}
+
+TreeNode*
+createBalancedBst(std::vector<int> values) {
+    if (!std::is_sorted(values.begin(), values.end())) {
+        std::sort(values.begin(), values.end());
+    }
+    return buildBalancedBst(values, [](int value) { return new TreeNode{value}; });
+}
+
+TreeNode*
+createBalancedBst(std::vector<int> values, tree_node_pool_t& pool) {
+    if (!std::is_sorted(values.begin(), values.end())) {
+        std::sort(values.begin(), values.end());
+    }
+    return createSortedBalancedBst(values, pool);
+}
+
+TreeNode*
+createSortedBalancedBst(std::span<int const> sortedValues, tree_node_pool_t& pool) {
+    return buildBalancedBst(sortedValues, [&](int value) { return pool.make(value); });
+}
+
+std::vector<int>
+inorder(TreeNode const* root) {
+    std::vector<int> result{};
+    inorder(root, std::back_inserter(result));
     return result;
 }
 
 std::vector<int>
 preorder(TreeNode const* root) {
     std::vector<int> result{};
+    preorder(root, std::back_inserter(result));
+    return result;
+}
 
-    if (root) {
-        result.push_back(root->val);
+std::vector<int>
+postorder(TreeNode const* root) {
+    std::vector<int> result{};
+    postorder(root, std::back_inserter(result));
+    return result;
+}
+
+std::vector<int>
+levelorder(TreeNode const* root) {
+    std::vector<int> result{};
+    levelorder(root, std::back_inserter(result));
+    return result;
+}
+
+namespace {
 
-        auto const leftResult = preorder(root->left);
-        std::copy(leftResult.begin(), leftResult.end(), std::back_inserter(result));
+//! createLevelOrderBT() with the nodes made by 'makeNode(value)'.
+template <typename MakeNode>
+TreeNode*
+buildLevelOrderBT(std::vector<int> const& levelOrderNodes, MakeNode makeNode) {
+    TreeNode* result{};
 
-        auto const rightResult = preorder(root->right);
-        std::copy(rightResult.begin(), rightResult.end(), std::back_inserter(result));
+    // Real nodes still waiting for their children, with their slot indices, in slot order.
+    // The children of slot 'i' are slots 2i + 1 and 2i + 2, so null slots need no entry.
+    std::deque<std::pair<TreeNode*, uint64_t>> parents{};
+    for (uint64_t slot = 0; levelOrderNodes.size() > slot; ++slot) {
+        auto const nodeValue = levelOrderNodes[static_cast<size_t>(slot)];
+        if (null == nodeValue) {
+            continue;
+        }
+
+        TreeNode** link = &result;
+        if (0 != slot) {
+            auto const parentSlot = (slot - 1) / 2;
+            while (!parents.empty() && parentSlot > parents.front().second) {
+                parents.pop_front();
+            }
+            if (parents.empty() || parentSlot != parents.front().second) {
+                throw std::invalid_argument{
+                    "level order value at slot " + std::to_string(slot) + " has no parent node"
+                };
+            }
+            link = 1 == slot % 2 ? &parents.front().first->left : &parents.front().first->right;
+        }
+
+        *link = makeNode(nodeValue);
+        parents.emplace_back(*link, slot);
     }
 
     return result;
 }
 
+//! createCompactLevelOrderBT() with the nodes made by 'makeNode(value)'.
+template <typename MakeNode>
+TreeNode*
+buildCompactLevelOrderBT(std::vector<int> const& levelOrderNodes, MakeNode makeNode) {
+    TreeNode* root{};
+    size_t levelOrderNodesIdx = 0;
+    if (!levelOrderNodes.empty()) {
+        auto const rootValue = levelOrderNodes[levelOrderNodesIdx++];
+        if (null != rootValue) {
+            root = makeNode(rootValue);
+        }
+    }
+
+    // Each queued real node takes the next two values as its left and right children.
+    std::deque<TreeNode*> parents{};
+    if (root) {
+        parents.push_back(root);
+    }
+    while (!parents.empty() && levelOrderNodes.size() > levelOrderNodesIdx) {
+        auto const parent = parents.front();
+        parents.pop_front();
+        for (auto const child : {&parent->left, &parent->right}) {
+            if (levelOrderNodes.size() == levelOrderNodesIdx) {
+                break;
+            }
+            auto const nodeValue = levelOrderNodes[levelOrderNodesIdx++];
+            if (null != nodeValue) {
+                *child = makeNode(nodeValue);
+                parents.push_back(*child);
+            }
+        }
+    }
+
+    if (levelOrderNodes.size() != levelOrderNodesIdx) {
+        throw std::invalid_argument{
+            "compact level order value at index " + std::to_string(levelOrderNodesIdx) + " has no parent node"
+        };
+    }
+
+    return root;
+}
+
+} // namespace {
+
 /*!
     \brief Convert array of node values in level order to a tree of nodes.
 
-    The array of node values is formatted like those used for leetcode problems.
+    The array of node values is formatted like those used for leetcode problems,
+    with every position of the tree present: the children of slot 'i' are slots
+    2i + 1 and 2i + 2.
     E.g. [3,9,20,null,null,15,7,null,null,null,null,30,40]
          describes:
                        03
@@ -102,46 +269,27 @@ preorder(TreeNode const* root) {
            --      --      15      07
          --  --  --  --  30  40  --  --
          Note that the '--'s at the end of the bottom row are excluded from the array.
+    Throws std::invalid_argument for a value whose parent slot is null, e.g.
+    for a compact dump (see createCompactLevelOrderBT()) of a sparse tree.
 */
 std::unique_ptr<TreeNode>
 createLevelOrderBT(std::vector<int> const& levelOrderNodes) {
+    // The first node made is the root and every later one is linked to its parent as it is made,
+    // so owning the root from the start frees everything made so far if the parser throws.
     std::unique_ptr<TreeNode> result{};
-    
-    std::deque<TreeNode*> treeNodes{};
-    size_t levelWidth = 1; // Node count in current level.
-    size_t levelOrderNodesIdx = 0;
-    while (levelOrderNodes.size() > levelOrderNodesIdx) {
-        // Process all [child] nodes in current tree level.
-        TreeNode* parent = nullptr;
-        for (auto childIdx = 0
-             ; levelWidth > childIdx
-               && levelOrderNodes.size() > levelOrderNodesIdx
-             ; ++childIdx
-        ) {
-            auto const firstChild = 0 == childIdx % 2;
-            
-            // Determine parent node for new child nodes.
-            parent = !firstChild
-                     ? parent // Continue using same parent.
-                     : treeNodes.empty()
-                       ? nullptr
-                       : [&]{ auto r = treeNodes.front(); treeNodes.pop_front(); return r; }();
-            
-            auto const nodeValue = levelOrderNodes[levelOrderNodesIdx++];
-            // Create new child node.
-            treeNodes.push_back(null == nodeValue ? nullptr : new TreeNode{nodeValue});
-            if (null != nodeValue) {
-                if (parent) { (firstChild ? parent->left : parent->right) = treeNodes.back(); }
-                if (!result) { result.reset(treeNodes.back()); }
-            }
-        }
-
-        levelWidth *= 2;
-    }
-
+    buildLevelOrderBT(levelOrderNodes, [&](int value) {
+        auto const node = new TreeNode{value};
+        if (!result) { result.reset(node); }
+        return node;
+    });
     return result;
 }
 
+TreeNode*
+createLevelOrderBT(std::vector<int> const& levelOrderNodes, tree_node_pool_t& pool) {
+    return buildLevelOrderBT(levelOrderNodes, [&](int value) { return pool.make(value); });
+}
+
 /*!
     \brief Convert a tree of nodes to array of node values in level order.
 
@@ -156,34 +304,43 @@ createLevelOrderBT(std::vector<int> const& levelOrderNodes) {
 std::vector<int>
 btToLevelOrder(TreeNode* root) {
     std::vector<int> result{};
+    btToLevelOrder(root, std::back_inserter(result));
+    return result;
+}
 
-    std::queue<TreeNode*> levelNodes{};
-    levelNodes.push(root);
-    auto lastValidResultSize = result.size();
-    while (!levelNodes.empty()) {
-        bool atLeastOneValidNodeEnqueued = false;
-        for (auto levelNodeCount = levelNodes.size(); levelNodeCount; --levelNodeCount) {
-            auto node = levelNodes.front();
-            levelNodes.pop();
-
-            if (node) {
-                levelNodes.push(node->left);
-                levelNodes.push(node->right);
-                result.push_back(node->val);
-                lastValidResultSize = result.size();
-                atLeastOneValidNodeEnqueued = true;
-            } else {
-                levelNodes.push(nullptr);
-                levelNodes.push(nullptr);
-                result.push_back(null);
-            }
-        }
-        if (!atLeastOneValidNodeEnqueued) {
-            result.erase(result.begin() + lastValidResultSize, result.end());
-            break;
-        }
-    }
+/*!
+    \brief Convert array of node values in compact level order to a tree of nodes.
+
+    Only the children of real nodes are listed, as on leetcode.
+    E.g. [3,9,20,null,null,15,7,30,40]
+         describes:
+                       03
+               09              20
+           --      --      15      07
+                             30  40
+         Trailing nulls are excluded from the array.
+*/
+std::unique_ptr<TreeNode>
+createCompactLevelOrderBT(std::vector<int> const& levelOrderNodes) {
+    // Owns the root from the start, like createLevelOrderBT().
+    std::unique_ptr<TreeNode> result{};
+    buildCompactLevelOrderBT(levelOrderNodes, [&](int value) {
+        auto const node = new TreeNode{value};
+        if (!result) { result.reset(node); }
+        return node;
+    });
+    return result;
+}
 
+TreeNode*
+createCompactLevelOrderBT(std::vector<int> const& levelOrderNodes, tree_node_pool_t& pool) {
+    return buildCompactLevelOrderBT(levelOrderNodes, [&](int value) { return pool.make(value); });
+}
+
+std::vector<int>
+btToCompactLevelOrder(TreeNode const* root) {
+    std::vector<int> result{};
+    btToCompactLevelOrder(root, std::back_inserter(result));
     return result;
 }
 
@@ -14,21 +14,30 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <barrier>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <deque>
 #include <doctest/doctest.h> //!\sa https://github.com/doctest/doctest/blob/master/doc/markdown/tutorial.md
 #include <functional>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
 #include <queue>
+#include <random>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <set>
 #include <span>
 #include <stack>
+#include <stdexcept>
+#include <thread>
 #include <tuple>
 
 using namespace std;
@@ -42,16 +51,80 @@ struct TreeNode {
     TreeNode() : val(0), left(nullptr), right(nullptr) {}
     TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
     TreeNode(int x, TreeNode *left, TreeNode *right) : val(x), left(left), right(right) {}
-    virtual ~TreeNode() {
-        if (left) {
-            delete left;
-        }
-        if (right) {
-            delete right;
+    ~TreeNode() {
+        deleteSubtree(left);
+        deleteSubtree(right);
+    }
+
+    /*!
+        \brief Delete the heap allocated subtree at 'node' without recursion.
+
+        While the current node has a left child, rotate right so the left child
+        becomes the current node; once it has none, delete it (with both links
+        cleared, so its destructor does nothing) and move on to its right child.
+        Every node is rotated at most once per ancestor on its left spine, so the
+        teardown is O(n) with O(1) extra space, even for a 10^6 node chain.
+    */
+    static void deleteSubtree(TreeNode* node) noexcept {
+        while (node) {
+            if (auto const child = node->left) {
+                node->left = child->right;
+                child->right = node;
+                node = child;
+            } else {
+                auto const next = node->right;
+                node->right = nullptr;
+                delete node;
+                node = next;
+            }
         }
     }
 };
 
+/*!
+    \brief Arena for TreeNodes: contiguous storage and O(1) bulk release.
+
+    Nodes are carved out of a monotonic buffer, one after the other, and are
+    never destroyed individually: the pool releases them all at once and does
+    not run their destructors.  The trees built from a pool are plain
+    TreeNode*, so every function taking a TreeNode* works on them, but they
+    must never be deleted (or owned by a std::unique_ptr<TreeNode>) and are
+    only valid while their pool lives.
+
+    With an exact 'nodeCountHint' all the nodes are in a single block drawn
+    from 'upstream'.
+*/
+class tree_node_pool_t
+{
+public:
+    explicit tree_node_pool_t(
+        size_t nodeCountHint = 0
+        , std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    ) : arena_{(std::max)(size_t{1}, nodeCountHint) * sizeof(TreeNode), upstream} {}
+
+    tree_node_pool_t(tree_node_pool_t const&) = delete;
+    tree_node_pool_t& operator=(tree_node_pool_t const&) = delete;
+
+    //! Construct a node in the pool.
+    TreeNode* make(int val, TreeNode* left = nullptr, TreeNode* right = nullptr) {
+        ++size_;
+        return ::new (arena_.allocate(sizeof(TreeNode), alignof(TreeNode))) TreeNode{val, left, right};
+    }
+
+    //! Nodes made since construction or the last release().
+    size_t size() const noexcept { return size_; }
+
+    //! Free every node of the pool at once; all trees built from it become invalid.
+    void release() noexcept {
+        arena_.release();
+        size_ = 0;
+    }
+
+private:
+    std::pmr::monotonic_buffer_resource arena_;
+    size_t size_{};
+};
+
 // [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
 
 constexpr auto const null = (std::numeric_limits<int>::min)();
@@ -70,21 +143,286 @@ struct elapsed_time_t
 std::ostream&
 operator<<(std::ostream& os, elapsed_time_t const& et);
 
+/*!
+    \brief Insert 'values' one by one into a BST; value < node->val goes left, anything else right.
+
+    A value below the smallest or at least the largest so far is appended to
+    the outer spine in O(1), so sorted input builds its (degenerate) tree in
+    O(n); other values cost O(height).
+*/
 TreeNode*
 createBst(std::vector<int> values);
 
+//! createBst() with the nodes made in 'pool' (see tree_node_pool_t).
+TreeNode*
+createBst(std::vector<int> const& values, tree_node_pool_t& pool);
+
+/*!
+    \brief Build a height balanced BST holding 'values' in one bulk pass.
+
+    'values' is sorted unless it already is; each subtree root is then the
+    middle of its range, moved down to the first of any run of equal values
+    so that duplicates end up in its right subtree, exactly as createBst()
+    places them (value < node->val goes left).  Runs of duplicates therefore
+    lengthen the tree; distinct values give a height of ceil(log2(n + 1)).
+
+    Time = O(n log n), or O(n) for sorted input.  No recursion.
+*/
+TreeNode*
+createBalancedBst(std::vector<int> values);
+
+//! createBalancedBst() with the nodes made in 'pool'; tree_node_pool_t{values.size()} makes it one block.
+TreeNode*
+createBalancedBst(std::vector<int> values, tree_node_pool_t& pool);
+
+/*!
+    \brief createBalancedBst() for input the caller knows is sorted: no copy, no sort.
+
+    'sortedValues' is only read, and only while the tree is built.
+*/
+TreeNode*
+createSortedBalancedBst(std::span<int const> sortedValues, tree_node_pool_t& pool);
+
+/*!
+    \brief Write the values of the tree in inorder (left, node, right) to 'out'.
+
+    Iterative: the explicit stack holds one node per level, so degenerate
+    (linked list) trees of any depth are fine and no per-node vectors are
+    built.  That stack is a std::vector, so a traversal does allocate its
+    O(height) scratch; only the values go through 'out', e.g. straight into
+    a preallocated buffer.  Returns the output iterator past the last value
+    written.
+
+    Time = O(n), Space = O(height)
+*/
+template <typename OutputIt>
+OutputIt
+inorder(TreeNode const* root, OutputIt out) {
+    std::vector<TreeNode const*> path{};
+    for (auto node = root; node || !path.empty(); ) {
+        // Descend to the leftmost node below 'node', remembering the way back up.
+        for (; node; node = node->left) {
+            path.push_back(node);
+        }
+        node = path.back();
+        path.pop_back();
+        *out++ = node->val;
+        node = node->right;
+    }
+    return out;
+}
+
+/*!
+    \brief Write the values of the tree in preorder (node, left, right) to 'out'.
+
+    Only right children wait on the explicit stack (scratch as in inorder()).
+
+    Time = O(n), Space = O(height)
+*/
+template <typename OutputIt>
+OutputIt
+preorder(TreeNode const* root, OutputIt out) {
+    std::vector<TreeNode const*> pendingRight{};
+    for (auto node = root; node || !pendingRight.empty(); ) {
+        if (!node) {
+            node = pendingRight.back();
+            pendingRight.pop_back();
+        }
+        *out++ = node->val;
+        if (node->right) {
+            pendingRight.push_back(node->right);
+        }
+        node = node->left;
+    }
+    return out;
+}
+
+/*!
+    \brief Write the values of the tree in postorder (left, right, node) to 'out'.
+
+    A node is emitted once its right subtree is done, i.e. when it has no right
+    child or the right child was the last node emitted.  Scratch as in inorder().
+
+    Time = O(n), Space = O(height)
+*/
+template <typename OutputIt>
+OutputIt
+postorder(TreeNode const* root, OutputIt out) {
+    std::vector<TreeNode const*> path{};
+    TreeNode const* lastEmitted = nullptr;
+    for (auto node = root; node || !path.empty(); ) {
+        for (; node; node = node->left) {
+            path.push_back(node);
+        }
+        auto const top = path.back();
+        if (top->right && lastEmitted != top->right) {
+            node = top->right;
+        } else {
+            *out++ = top->val;
+            lastEmitted = top;
+            path.pop_back();
+        }
+    }
+    return out;
+}
+
+/*!
+    \brief Write the values of the tree in level order (top to bottom, left to right) to 'out'.
+
+    Only real nodes are queued and no null placeholders are written; see
+    btToLevelOrder() for the leetcode style null padded form.  The queue is a
+    std::deque, so a traversal allocates O(width) scratch.
+
+    Time = O(n), Space = O(width)
+*/
+template <typename OutputIt>
+OutputIt
+levelorder(TreeNode const* root, OutputIt out) {
+    std::deque<TreeNode const*> levelNodes{};
+    if (root) {
+        levelNodes.push_back(root);
+    }
+    while (!levelNodes.empty()) {
+        auto const node = levelNodes.front();
+        levelNodes.pop_front();
+        *out++ = node->val;
+        if (node->left) { levelNodes.push_back(node->left); }
+        if (node->right) { levelNodes.push_back(node->right); }
+    }
+    return out;
+}
+
 std::vector<int>
 inorder(TreeNode const* root);
 
 std::vector<int>
 preorder(TreeNode const* root);
 
+std::vector<int>
+postorder(TreeNode const* root);
+
+std::vector<int>
+levelorder(TreeNode const* root);
+
 std::unique_ptr<TreeNode>
 createLevelOrderBT(std::vector<int> const& levelOrderNodes);
 
+//! createLevelOrderBT() with the nodes made in 'pool' (see tree_node_pool_t).
+TreeNode*
+createLevelOrderBT(std::vector<int> const& levelOrderNodes, tree_node_pool_t& pool);
+
+/*!
+    \brief Stream the tree to 'out' in the positional level order format read by createLevelOrderBT().
+
+    Slot 'i' of the format holds the node whose children are slots 2i + 1 and
+    2i + 2, so the format itself pads every missing subtree with nulls.  Only
+    real nodes are queued, each with its 64 bit slot index, and the nulls
+    between two real nodes are written as a run, so memory is proportional to
+    the number of real nodes; the output (and the time to write it) is as long
+    as the format makes it, ~2^depth for a skewed tree.  Trailing nulls are not
+    written.  Throws std::length_error, before writing anything, for trees
+    deeper than a 64 bit slot index can address (64 levels); see
+    btToCompactLevelOrder() for dumping those.
+
+    Space = O(width)
+*/
+template <typename OutputIt>
+OutputIt
+btToLevelOrder(TreeNode const* root, OutputIt out) {
+    // Check the depth before writing anything: slots of level 'd' start at 2^d - 1.
+    std::deque<TreeNode const*> level{};
+    if (root) {
+        level.push_back(root);
+    }
+    for (int depth = 0; !level.empty(); ++depth) {
+        if (std::numeric_limits<uint64_t>::digits <= depth) {
+            throw std::length_error{"tree too deep for the positional level order format"};
+        }
+        for (auto levelNodeCount = level.size(); levelNodeCount; --levelNodeCount) {
+            auto const node = level.front();
+            level.pop_front();
+            if (node->left) { level.push_back(node->left); }
+            if (node->right) { level.push_back(node->right); }
+        }
+    }
+
+    std::deque<std::pair<TreeNode const*, uint64_t>> levelNodes{};
+    if (root) {
+        levelNodes.emplace_back(root, 0);
+    }
+    // Slots are queued in increasing order, so each one only needs the nulls since the previous.
+    uint64_t nextSlot = 0;
+    while (!levelNodes.empty()) {
+        auto const [node, slot] = levelNodes.front();
+        levelNodes.pop_front();
+        out = std::fill_n(out, slot - nextSlot, null);
+        *out++ = node->val;
+        nextSlot = slot + 1;
+
+        if (node->left) { levelNodes.emplace_back(node->left, 2 * slot + 1); }
+        if (node->right) { levelNodes.emplace_back(node->right, 2 * slot + 2); }
+    }
+    return out;
+}
+
 std::vector<int>
 btToLevelOrder(TreeNode* root);
 
+/*!
+    \brief Parse the compact leetcode level order format written by btToCompactLevelOrder().
+
+    Throws std::invalid_argument when values are left over once every real
+    node has its two children, e.g. for a positional createLevelOrderBT()
+    dump with nulls under a missing node.
+*/
+std::unique_ptr<TreeNode>
+createCompactLevelOrderBT(std::vector<int> const& levelOrderNodes);
+
+//! createCompactLevelOrderBT() with the nodes made in 'pool' (see tree_node_pool_t).
+TreeNode*
+createCompactLevelOrderBT(std::vector<int> const& levelOrderNodes, tree_node_pool_t& pool);
+
+/*!
+    \brief Stream the tree to 'out' in the compact leetcode level order format.
+
+    Every real node is followed, in level order, by its two child slots; a
+    missing child is written as 'null' and children of missing nodes are not
+    written at all.  Nulls are held back as a count until a value follows, so
+    trailing nulls are never written.  Only real nodes are queued, so time and
+    memory are proportional to the number of real nodes, whatever the shape.
+
+    Time = O(n), Space = O(width)
+*/
+template <typename OutputIt>
+OutputIt
+btToCompactLevelOrder(TreeNode const* root, OutputIt out) {
+    if (!root) {
+        return out;
+    }
+
+    *out++ = root->val;
+    std::deque<TreeNode const*> levelNodes{root};
+    size_t pendingNulls = 0;
+    while (!levelNodes.empty()) {
+        auto const node = levelNodes.front();
+        levelNodes.pop_front();
+        for (auto const child : {node->left, node->right}) {
+            if (child) {
+                out = std::fill_n(out, pendingNulls, null);
+                pendingNulls = 0;
+                *out++ = child->val;
+                levelNodes.push_back(child);
+            } else {
+                ++pendingNulls;
+            }
+        }
+    }
+    return out;
+}
+
+std::vector<int>
+btToCompactLevelOrder(TreeNode const* root);
+
 #endif // #ifndef UTILS_HPP_4F58C358_FF95_42DE_A545_7DEA5504DE2C
 
 /*
@@ -0,0 +1,129 @@
+/*!
+    \file "workloads.cpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Generated prerequisite graphs for benchmarking and testing the course schedule engines.
+*/
+
+#include "workloads.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <random>
+
+workload_t
+makeChainWorkload(int edgeCount) {
+    assert(0 <= edgeCount);
+
+    workload_t workload{edgeCount + 1, {}};
+    workload.prerequisites.reserve(static_cast<size_t>(edgeCount));
+    for (int course = 1; workload.numCourses > course; ++course) {
+        workload.prerequisites.emplace_back(course, course - 1);
+    }
+
+    return workload;
+}
+
+workload_t
+makeWideDagWorkload(int edgeCount, std::uint32_t seed, int layerCount, int fanOut) {
+    assert(1 < layerCount && 0 < fanOut);
+
+    auto const layerWidth = (std::max)(1, edgeCount / ((layerCount - 1) * fanOut));
+    workload_t workload{layerCount * layerWidth, {}};
+    workload.prerequisites.reserve(static_cast<size_t>((layerCount - 1) * layerWidth * fanOut));
+
+    std::mt19937 random{seed};
+    std::uniform_int_distribution<int> pick{0, layerWidth - 1};
+    for (int layer = 1; layerCount > layer; ++layer) {
+        for (int slot = 0; layerWidth > slot; ++slot) {
+            for (int edge = 0; fanOut > edge; ++edge) {
+                workload.prerequisites.emplace_back(layer * layerWidth + slot, (layer - 1) * layerWidth + pick(random));
+            }
+        }
+    }
+
+    return workload;
+}
+
+namespace {
+
+/*!
+    \brief Return 'edgeCount' distinct (rank, lower rank) pairs over ranks [0, numCourses), in random order.
+
+    Candidates are deduplicated by sorting rather than hashing so that
+    generating 10^7 prerequisites needs ~8 bytes of scratch per prerequisite.
+*/
+std::vector<std::pair<int, int>>
+randomRankedEdges(int numCourses, int edgeCount, std::mt19937& random) {
+    assert(1 < numCourses);
+    assert(static_cast<long long>(numCourses) * (numCourses - 1) / 2 >= edgeCount);
+
+    std::uniform_int_distribution<int> pick{0, numCourses - 1};
+    std::vector<long long> keys{};
+    keys.reserve(static_cast<size_t>(edgeCount));
+    while (edgeCount > static_cast<int>(keys.size())) {
+        while (edgeCount > static_cast<int>(keys.size())) {
+            auto rank = pick(random);
+            auto lowerRank = pick(random);
+            if (rank == lowerRank) { continue; }
+            if (rank < lowerRank) { std::swap(rank, lowerRank); }
+            keys.push_back(static_cast<long long>(rank) * numCourses + lowerRank);
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+    std::shuffle(keys.begin(), keys.end(), random);
+
+    std::vector<std::pair<int, int>> edges{};
+    edges.reserve(keys.size());
+    for (auto const key : keys) {
+        edges.emplace_back(static_cast<int>(key / numCourses), static_cast<int>(key % numCourses));
+    }
+    return edges;
+}
+
+} // namespace {
+
+workload_t
+makeRandomDagWorkload(int numCourses, int edgeCount, std::uint32_t seed) {
+    std::mt19937 random{seed};
+    workload_t workload{numCourses, randomRankedEdges(numCourses, edgeCount, random)};
+
+    // Ranks define the hidden topological order; relabel so it is not the label order.
+    std::vector<int> labels(static_cast<size_t>(numCourses));
+    std::iota(labels.begin(), labels.end(), 0);
+    std::shuffle(labels.begin(), labels.end(), random);
+    for (auto& [course, prerequisite] : workload.prerequisites) {
+        course = labels[static_cast<size_t>(course)];
+        prerequisite = labels[static_cast<size_t>(prerequisite)];
+    }
+
+    return workload;
+}
+
+workload_t
+makeLateCycleWorkload(int edgeCount, std::uint32_t seed) {
+    assert(3 <= edgeCount);
+
+    // Random DAG over the low labels (label order == rank order) ...
+    auto const dagCourses = (std::max)(3, edgeCount / 2);
+    std::mt19937 random{seed};
+    workload_t workload{dagCourses + 2, randomRankedEdges(dagCourses, edgeCount - 3, random)};
+
+    // ... plus two courses with the highest labels that require each other (and the DAG's top course).
+    auto const first = dagCourses;
+    auto const second = dagCourses + 1;
+    workload.prerequisites.emplace_back(first, second);
+    workload.prerequisites.emplace_back(second, first);
+    workload.prerequisites.emplace_back(first, dagCourses - 1);
+
+    return workload;
+}
+
+/*
+    End of "workloads.cpp"
+*/
@@ -0,0 +1,69 @@
+/*!
+    \file "workloads.hpp"
+
+    Author: Matt Ervin <matt@impsoftware.org>
+    Formatting: 4 spaces/tab (spaces only; no tabs), 120 columns.
+    Doc-tool: Doxygen (http://www.doxygen.com/)
+
+    Generated prerequisite graphs for benchmarking and testing the course schedule engines.
+*/
+
+#ifndef WORKLOADS_HPP_C960C437_75DF_4C96_A0EA_EB43A21673FC
+#define WORKLOADS_HPP_C960C437_75DF_4C96_A0EA_EB43A21673FC
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// [----------------(120 columns)---------------> Module Code Delimiter <---------------(120 columns)----------------]
+
+/*!
+    \brief A generated course catalog.
+
+    prerequisites[i] = (ai, bi) means course bi must be taken before course ai.
+*/
+struct workload_t
+{
+    int numCourses{};
+    std::vector<std::pair<int, int>> prerequisites{};
+};
+
+/*!
+    \brief Single linear chain: course i requires course i - 1.
+
+    Worst case for recursion depth; acyclic.
+*/
+workload_t
+makeChainWorkload(int edgeCount);
+
+/*!
+    \brief Few, very wide layers: each course requires 'fanOut' random courses of the previous layer.
+
+    Best case for frontier parallelism; acyclic.
+*/
+workload_t
+makeWideDagWorkload(int edgeCount, std::uint32_t seed, int layerCount = 16, int fanOut = 4);
+
+/*!
+    \brief Uniformly random DAG with 'numCourses' courses and 'edgeCount' distinct prerequisites.
+
+    Course labels are shuffled so the topological order is not the label order.
+*/
+workload_t
+makeRandomDagWorkload(int numCourses, int edgeCount, std::uint32_t seed);
+
+/*!
+    \brief Random DAG plus a single two course cycle that no other course depends on.
+
+    The cycle is only reachable from its own two courses, which carry the
+    highest labels, so engines that scan courses in label order find it last.
+*/
+workload_t
+makeLateCycleWorkload(int edgeCount, std::uint32_t seed);
+
+#endif // #ifndef WORKLOADS_HPP_C960C437_75DF_4C96_A0EA_EB43A21673FC
+
+/*
+    End of "workloads.hpp"
+*/